@@ -1,4 +1,4 @@
-QT       += core gui widgets
+QT       += core gui widgets network
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -10,12 +10,28 @@ CONFIG += c++17
 
 SOURCES += \
     main.cpp \
-    MainWindow.cpp \
-    HangmanGame.cpp
+    mainwindow.cpp \
+    hangmangame.cpp \
+    scoreboard.cpp \
+    gamelog.cpp \
+    uistressharness.cpp \
+    worddictionary.cpp \
+    processstats.cpp \
+    spectatorchannel.cpp \
+    animationclock.cpp \
+    labeltextanimation.cpp
 
 HEADERS += \
-    MainWindow.h \
-    HangmanGame.h
+    mainwindow.h \
+    hangmangame.h \
+    scoreboard.h \
+    gamelog.h \
+    uistressharness.h \
+    worddictionary.h \
+    processstats.h \
+    spectatorchannel.h \
+    animationclock.h \
+    labeltextanimation.h
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
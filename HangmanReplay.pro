@@ -0,0 +1,25 @@
+QT       = core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+# Replays a binary event log written by the game (see gamelog.h)
+
+# "make check" runs the allocation check; heap allocations are counted on glibc
+CONFIG += testcase no_testcase_installs
+TESTARGS = --check-allocations
+
+SOURCES += \
+    replaymain.cpp \
+    hangmangame.cpp \
+    scoreboard.cpp \
+    gamelog.cpp \
+    worddictionary.cpp \
+    allocationcounter.cpp
+
+HEADERS += \
+    hangmangame.h \
+    scoreboard.h \
+    gamelog.h \
+    worddictionary.h \
+    allocationcounter.h
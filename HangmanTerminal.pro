@@ -0,0 +1,28 @@
+QT       = core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+# Terminal frontend: links only QtCore, no QtGui/QtWidgets
+
+SOURCES += \
+    terminalmain.cpp \
+    terminalwindow.cpp \
+    processstats.cpp \
+    hangmangame.cpp \
+    scoreboard.cpp \
+    gamelog.cpp \
+    worddictionary.cpp
+
+HEADERS += \
+    terminalwindow.h \
+    processstats.h \
+    hangmangame.h \
+    scoreboard.h \
+    gamelog.h \
+    worddictionary.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,18 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+/**
+ * @brief The AllocationCounter class counts heap allocations process-wide
+ * Only linked into the replay tool, where it wraps malloc on glibc so both
+ * operator new and Qt containers are counted
+ */
+class AllocationCounter
+{
+public:
+    static bool isAvailable();
+    static quint64 count();
+};
+
+#endif // ALLOCATIONCOUNTER_H
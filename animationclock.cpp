@@ -0,0 +1,93 @@
+#include "animationclock.h"
+
+AnimationClock::AnimationClock(QObject* parent)
+    : QObject(parent)
+    , m_lastTickNs(-1)
+    , m_frames(0)
+    , m_skippedFrames(0)
+    , m_totalIntervalNs(0)
+    , m_worstIntervalNs(0)
+    , m_worstWorkNs(0)
+{
+    m_clock.start();
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(FRAME_INTERVAL_MS);
+    connect(&m_timer, &QTimer::timeout, this, &AnimationClock::onTick);
+}
+
+void AnimationClock::start(Animation* animation)
+{
+    if (!m_active.contains(animation)) {
+        m_active.append(animation);
+    }
+
+    if (!m_timer.isActive()) {
+        m_lastTickNs = -1; // Idle time is not a frame interval
+        m_timer.start();
+    }
+}
+
+void AnimationClock::stop(Animation* animation)
+{
+    m_active.removeAll(animation);
+    if (m_active.isEmpty()) {
+        m_timer.stop();
+    }
+}
+
+void AnimationClock::onTick()
+{
+    qint64 tickNs = m_clock.nsecsElapsed();
+
+    if (m_lastTickNs >= 0) {
+        qint64 intervalNs = tickNs - m_lastTickNs;
+        m_frames++;
+        m_totalIntervalNs += intervalNs;
+        m_worstIntervalNs = qMax(m_worstIntervalNs, intervalNs);
+
+        // A tick that arrives n frames late stands in for n - 1 skipped frames
+        const qint64 frameNs = 1000000000LL / 60;
+        int late = static_cast<int>((intervalNs + frameNs / 2) / frameNs) - 1;
+        if (late > 0) {
+            m_skippedFrames += late;
+        }
+    }
+    m_lastTickNs = tickNs;
+
+    // Advance everything against one timestamp; finished animations drop out
+    qint64 nowMs = tickNs / 1000000;
+    for (int i = m_active.size() - 1; i >= 0; --i) {
+        if (!m_active[i]->advance(nowMs)) {
+            m_active.removeAt(i);
+        }
+    }
+    m_worstWorkNs = qMax(m_worstWorkNs, m_clock.nsecsElapsed() - tickNs);
+
+    if (m_active.isEmpty()) {
+        m_timer.stop();
+    }
+}
+
+AnimationClock::FrameStats AnimationClock::getFrameStats() const
+{
+    FrameStats stats;
+    stats.frames = m_frames;
+    stats.skippedFrames = m_skippedFrames;
+    if (m_frames > 0) {
+        stats.averageIntervalMs = m_totalIntervalNs / 1e6 / m_frames;
+    }
+    stats.worstIntervalMs = m_worstIntervalNs / 1e6;
+    stats.worstWorkMs = m_worstWorkNs / 1e6;
+    return stats;
+}
+
+QString AnimationClock::describeFrameStats() const
+{
+    FrameStats stats = getFrameStats();
+    return QString("%1 frames, %2 skipped, average %3 ms, worst %4 ms, worst work %5 ms")
+        .arg(stats.frames)
+        .arg(stats.skippedFrames)
+        .arg(stats.averageIntervalMs, 0, 'f', 2)
+        .arg(stats.worstIntervalMs, 0, 'f', 2)
+        .arg(stats.worstWorkMs, 0, 'f', 2);
+}
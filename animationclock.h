@@ -0,0 +1,72 @@
+#ifndef ANIMATIONCLOCK_H
+#define ANIMATIONCLOCK_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QVector>
+#include <QString>
+
+/**
+ * @brief Base class for anything driven by an AnimationClock
+ */
+class Animation : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit Animation(QObject* parent = nullptr) : QObject(parent) {}
+
+    // Moves to the state for the given clock time, returns false when done
+    virtual bool advance(qint64 nowMs) = 0;
+};
+
+/**
+ * @brief The AnimationClock class drives all animations from one timer
+ * Every running animation advances on the same tick, so their widget
+ * updates land in a single repaint per frame. Animations are time based,
+ * so a late tick skips frames instead of slowing down, and the timer only
+ * runs while something is animating
+ */
+class AnimationClock : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct FrameStats {
+        int frames = 0;
+        int skippedFrames = 0;
+        double averageIntervalMs = 0.0;
+        double worstIntervalMs = 0.0;
+        double worstWorkMs = 0.0;   // Time spent advancing animations
+    };
+
+    explicit AnimationClock(QObject* parent = nullptr);
+
+    void start(Animation* animation);
+    void stop(Animation* animation);
+    qint64 now() const { return m_clock.elapsed(); }
+    bool isRunning() const { return m_timer.isActive(); }
+
+    FrameStats getFrameStats() const;
+    QString describeFrameStats() const;
+
+    static const int FRAME_INTERVAL_MS = 16; // ~60 fps
+
+private slots:
+    void onTick();
+
+private:
+    QElapsedTimer m_clock;
+    QTimer m_timer;
+    QVector<Animation*> m_active;
+
+    qint64 m_lastTickNs;
+    int m_frames;
+    int m_skippedFrames;
+    qint64 m_totalIntervalNs;
+    qint64 m_worstIntervalNs;
+    qint64 m_worstWorkNs;
+};
+
+#endif // ANIMATIONCLOCK_H
@@ -0,0 +1,204 @@
+#include "gamelog.h"
+
+const QByteArray GameLog::MAGIC("HGL1", 4);
+
+GameLog::GameLog(const QString& fileName)
+    : m_file(fileName)
+    , m_lastEventNs(0)
+{
+    // Events are batched in m_buffer, so QFile's own write buffer is redundant
+    if (m_file.open(QIODevice::Append | QIODevice::Unbuffered)) {
+        if (m_file.size() == 0) {
+            m_file.write(MAGIC);
+        }
+    }
+
+    m_buffer.reserve(BUFFER_SIZE);
+    m_clock.start();
+}
+
+GameLog::~GameLog()
+{
+    flush();
+}
+
+void GameLog::logStart(HangmanGame::Theme theme, quint32 seed, const QString& word)
+{
+    beginEvent(GameEvent::Type::Start);
+    writeByte(static_cast<quint8>(theme));
+    writeVarint(seed);
+
+    const QByteArray utf8 = word.toUtf8();
+    writeVarint(static_cast<quint64>(utf8.size()));
+    m_buffer.append(utf8);
+}
+
+void GameLog::logGuess(QChar letter, bool found, int remainingTries)
+{
+    beginEvent(GameEvent::Type::Guess);
+    writeVarint(letter.unicode());
+    writeByte(found ? 1 : 0);
+    writeByte(static_cast<quint8>(remainingTries));
+}
+
+void GameLog::logHint(QChar letter, int remainingTries)
+{
+    beginEvent(GameEvent::Type::Hint);
+    writeVarint(letter.unicode());
+    writeByte(static_cast<quint8>(remainingTries));
+}
+
+void GameLog::logEnd(bool won, int remainingTries)
+{
+    beginEvent(GameEvent::Type::End);
+    writeByte(won ? 1 : 0);
+    writeByte(static_cast<quint8>(remainingTries));
+
+    // A finished game is a natural checkpoint
+    flush();
+}
+
+void GameLog::flush()
+{
+    if (m_buffer.isEmpty()) {
+        return;
+    }
+
+    if (m_file.isOpen()) {
+        m_file.write(m_buffer);
+    }
+
+    // clear() would free the reserved capacity, resize keeps it for the next batch
+    m_buffer.resize(0);
+}
+
+void GameLog::beginEvent(GameEvent::Type type)
+{
+    if (m_buffer.size() >= BUFFER_SIZE) {
+        flush();
+    }
+
+    qint64 now = m_clock.nsecsElapsed();
+    writeByte(static_cast<quint8>(type));
+    writeVarint(static_cast<quint64>((now - m_lastEventNs) / 1000));
+    m_lastEventNs = now;
+}
+
+void GameLog::writeByte(quint8 value)
+{
+    m_buffer.append(static_cast<char>(value));
+}
+
+void GameLog::writeVarint(quint64 value)
+{
+    // LEB128: 7 bits per byte, high bit set on all but the last byte
+    while (value >= 0x80) {
+        writeByte(static_cast<quint8>(value | 0x80));
+        value >>= 7;
+    }
+    writeByte(static_cast<quint8>(value));
+}
+
+GameLogReader::GameLogReader(const QString& fileName)
+    : m_pos(0)
+    , m_valid(false)
+    , m_error(false)
+{
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadOnly)) {
+        m_data = file.readAll();
+        file.close();
+    }
+
+    if (m_data.startsWith(GameLog::MAGIC)) {
+        m_pos = GameLog::MAGIC.size();
+        m_valid = true;
+    }
+}
+
+bool GameLogReader::readNext(GameEvent& event)
+{
+    if (!m_valid || m_error || m_pos >= m_data.size()) {
+        return false;
+    }
+
+    quint8 type = 0;
+    quint8 byte = 0;
+    quint64 value = 0;
+
+    event = GameEvent();
+    bool ok = readByte(type) && readVarint(event.elapsedUs);
+
+    if (ok) {
+        event.type = static_cast<GameEvent::Type>(type);
+
+        switch (event.type) {
+        case GameEvent::Type::Start:
+            ok = readByte(byte) && readVarint(value);
+            event.theme = static_cast<HangmanGame::Theme>(byte);
+            event.seed = static_cast<quint32>(value);
+            if (ok && readVarint(value) && value <= static_cast<quint64>(m_data.size() - m_pos)) {
+                event.word = QString::fromUtf8(m_data.constData() + m_pos, static_cast<int>(value));
+                m_pos += static_cast<int>(value);
+            } else {
+                ok = false;
+            }
+            break;
+
+        case GameEvent::Type::Guess:
+            ok = readVarint(value) && readByte(byte);
+            event.letter = QChar(static_cast<char16_t>(value));
+            event.found = byte != 0;
+            ok = ok && readByte(byte);
+            event.remainingTries = byte;
+            break;
+
+        case GameEvent::Type::Hint:
+            ok = readVarint(value) && readByte(byte);
+            event.letter = QChar(static_cast<char16_t>(value));
+            event.remainingTries = byte;
+            break;
+
+        case GameEvent::Type::End:
+            ok = readByte(byte);
+            event.won = byte != 0;
+            ok = ok && readByte(byte);
+            event.remainingTries = byte;
+            break;
+
+        default:
+            ok = false;
+            break;
+        }
+    }
+
+    if (!ok) {
+        m_error = true; // Truncated or corrupt record
+    }
+    return ok;
+}
+
+bool GameLogReader::readByte(quint8& value)
+{
+    if (m_pos >= m_data.size()) {
+        return false;
+    }
+    value = static_cast<quint8>(m_data[m_pos++]);
+    return true;
+}
+
+bool GameLogReader::readVarint(quint64& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        quint8 byte = 0;
+        if (!readByte(byte)) {
+            return false;
+        }
+        value |= static_cast<quint64>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
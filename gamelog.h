@@ -0,0 +1,90 @@
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+#include <QElapsedTimer>
+#include "hangmangame.h"
+
+/**
+ * @brief A single decoded game event
+ * Only the fields relevant to the event type are meaningful
+ */
+struct GameEvent
+{
+    enum class Type : quint8 {
+        Start = 1,
+        Guess = 2,
+        Hint = 3,
+        End = 4
+    };
+
+    Type type = Type::Start;
+    quint64 elapsedUs = 0;   // Time since the previous event
+    HangmanGame::Theme theme = HangmanGame::Theme::Animals;
+    quint32 seed = 0;
+    QString word;
+    QChar letter;
+    bool found = false;
+    bool won = false;
+    int remainingTries = 0;
+};
+
+/**
+ * @brief The GameLog class appends game events to a compact binary file
+ * Events are varint encoded into an in-memory buffer that is written out
+ * when it fills up or a game ends, so logging costs no syscall per guess
+ */
+class GameLog
+{
+public:
+    explicit GameLog(const QString& fileName);
+    ~GameLog();
+
+    bool isOpen() const { return m_file.isOpen(); }
+
+    void logStart(HangmanGame::Theme theme, quint32 seed, const QString& word);
+    void logGuess(QChar letter, bool found, int remainingTries);
+    void logHint(QChar letter, int remainingTries);
+    void logEnd(bool won, int remainingTries);
+    void flush();
+
+    static const QByteArray MAGIC;
+
+private:
+    void beginEvent(GameEvent::Type type);
+    void writeByte(quint8 value);
+    void writeVarint(quint64 value);
+
+    QFile m_file;
+    QByteArray m_buffer;
+    QElapsedTimer m_clock;
+    qint64 m_lastEventNs;
+
+    static const int BUFFER_SIZE = 4096;
+};
+
+/**
+ * @brief The GameLogReader class decodes a file written by GameLog
+ */
+class GameLogReader
+{
+public:
+    explicit GameLogReader(const QString& fileName);
+
+    bool isValid() const { return m_valid; }
+    bool hasError() const { return m_error; }
+    bool readNext(GameEvent& event);
+
+private:
+    bool readByte(quint8& value);
+    bool readVarint(quint64& value);
+
+    QByteArray m_data;
+    int m_pos;
+    bool m_valid;
+    bool m_error;
+};
+
+#endif // GAMELOG_H
@@ -1,65 +1,127 @@
-#include "HangmanGame.h"
+#include "hangmangame.h"
+#include "gamelog.h"
+#include "scoreboard.h"
+#include <QDateTime>
+#include <QtAlgorithms>
+#include <iterator>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define HANGMAN_USE_SSE2
+#endif
+
+namespace {
+
+/**
+ * Calls onMatch(i) for every i where text[i] == letter and returns the
+ * number of matches. With SSE2, eight UTF-16 code units are compared per
+ * step and chunks without a match cost a single branch.
+ */
+template <typename Callback>
+int forEachMatch(const QChar* text, int length, QChar letter, Callback onMatch)
+{
+    int matches = 0;
+    int i = 0;
+
+#ifdef HANGMAN_USE_SSE2
+    const __m128i needle = _mm_set1_epi16(static_cast<short>(letter.unicode()));
+    for (; i + 8 <= length; i += 8) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+
+        // movemask yields one bit per byte, so each matching code unit sets two bits
+        uint mask = static_cast<uint>(_mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle)));
+        while (mask) {
+            onMatch(i + qCountTrailingZeroBits(mask) / 2);
+            matches++;
+            mask &= mask - 1;
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < length; ++i) {
+        if (text[i] == letter) {
+            onMatch(i);
+            matches++;
+        }
+    }
+    return matches;
+}
+
+} // namespace
 
 const QString HangmanGame::SCORES_FILE = "scores.txt";
 
 HangmanGame::HangmanGame()
-    : m_remainingTries(7)
+    : m_dictionary(&WordDictionary::builtIn())
+    , m_currentTheme(Theme::Animals)
+    , m_seed(0)
+    , m_hiddenCount(0)
+    , m_remainingTries(7)
     , m_hintUsed(false)
+    , m_gameFinished(true)
+    , m_scoreBoard(nullptr)
+    , m_eventLog(nullptr)
 {
-    initializeWordLists();
 }
 
-void HangmanGame::initializeWordLists()
+void HangmanGame::startNewGame(Theme theme, const QString& playerName)
 {
-    // Animals theme
-    m_wordLists[Theme::Animals] = QStringList{
-        "elephant", "giraffe", "penguin", "dolphin", "kangaroo",
-        "butterfly", "crocodile", "hippopotamus", "cheetah", "octopus"
-    };
-
-    // Countries theme
-    m_wordLists[Theme::Countries] = QStringList{
-        "australia", "brazil", "canada", "denmark", "egypt",
-        "france", "germany", "india", "japan", "mexico"
-    };
-
-    // Fruits theme
-    m_wordLists[Theme::Fruits] = QStringList{
-        "apple", "banana", "cherry", "mango", "orange",
-        "pineapple", "strawberry", "watermelon", "blueberry", "papaya"
-    };
-
-    // Sports theme
-    m_wordLists[Theme::Sports] = QStringList{
-        "football", "basketball", "tennis", "cricket", "volleyball",
-        "baseball", "hockey", "badminton", "swimming", "athletics"
-    };
-
-    // Colors theme
-    m_wordLists[Theme::Colors] = QStringList{
-        "red", "blue", "green", "yellow", "purple",
-        "orange", "pink", "brown", "black", "white"
-    };
+    startNewGame(theme, QRandomGenerator::global()->generate(), playerName);
 }
 
-void HangmanGame::startNewGame(Theme theme)
+void HangmanGame::startNewGame(Theme theme, quint32 seed, const QString& playerName)
 {
-    m_secretWord = selectRandomWord(theme);
-    m_currentProgress = QString(m_secretWord.length(), '_');
+    m_currentTheme = theme;
+    m_playerName = playerName;
+    m_seed = seed;
+    m_secretWord = selectRandomWord(theme, seed);
+
+    // Spaces and punctuation in phrases are shown from the start
+    m_currentProgress = m_secretWord;
+    m_hiddenCount = 0;
+    for (int i = 0; i < m_secretWord.length(); ++i) {
+        if (m_secretWord[i].isLetter()) {
+            m_currentProgress[i] = '_';
+            m_hiddenCount++;
+        }
+    }
+
     m_guessedLetters.clear();
+    m_guessedLetters.reserve(26);
+
+    // Display strings are sized once per game and patched in place per guess.
+    // Letters of one word are joined by non-breaking spaces so a wrapping
+    // label can only break a phrase at the gaps between words
+    m_progressText = QString(qMax(0, 2 * m_secretWord.length() - 1), ' ');
+    for (int i = 0; i < m_secretWord.length(); ++i) {
+        m_progressText[2 * i] = m_currentProgress[i];
+        if (i > 0 && m_secretWord[i - 1] != ' ' && m_secretWord[i] != ' ') {
+            m_progressText[2 * i - 1] = QChar::Nbsp;
+        }
+    }
+    m_guessedText.clear();
+    m_guessedText.reserve(26 * 3);
     m_remainingTries = 7;
     m_hintUsed = false;
+    m_gameFinished = false;
+
+    if (m_eventLog) {
+        m_eventLog->logStart(theme, seed, m_secretWord);
+    }
 }
 
-QString HangmanGame::selectRandomWord(Theme theme)
+QString HangmanGame::selectRandomWord(Theme theme, quint32 seed)
 {
-    const QStringList& words = m_wordLists[theme];
-    if (words.isEmpty()) {
+    int list = static_cast<int>(theme);
+    int count = m_dictionary->getWordCount(list);
+    if (count == 0) {
         return "hangman"; // Fallback
     }
 
-    int index = QRandomGenerator::global()->bounded(words.size());
-    return words[index].toLower();
+    // Seeded so a logged game can be replayed with the same word
+    QRandomGenerator generator(seed);
+    return m_dictionary->getWord(list, generator.bounded(count));
 }
 
 bool HangmanGame::guessLetter(QChar letter)
@@ -71,24 +133,26 @@ bool HangmanGame::guessLetter(QChar letter)
         return false; // Already guessed, don't penalize
     }
 
-    m_guessedLetters.append(letter);
+    recordGuessedLetter(letter);
 
     // Check if letter is in the word
-    bool found = false;
-    for (int i = 0; i < m_secretWord.length(); ++i) {
-        if (m_secretWord[i] == letter) {
-            m_currentProgress[i] = letter;
-            found = true;
-        }
-    }
+    bool found = revealLetter(letter);
 
     if (!found) {
         m_remainingTries--;
+    }
 
-        // Auto-hint at 2 remaining tries
-        if (m_remainingTries == 2 && !m_hintUsed) {
-            applyHint();
-        }
+    if (m_eventLog) {
+        m_eventLog->logGuess(letter, found, m_remainingTries);
+    }
+
+    // Auto-hint at 2 remaining tries
+    if (!found && m_remainingTries == 2 && !m_hintUsed) {
+        applyHint();
+    }
+
+    if (!m_gameFinished && isGameOver()) {
+        finishGame();
     }
 
     return found;
@@ -99,23 +163,73 @@ void HangmanGame::applyHint()
     m_hintUsed = true;
 
     // Find first unrevealed letter
-    for (int i = 0; i < m_secretWord.length(); ++i) {
-        if (m_currentProgress[i] == '_') {
-            QChar hintLetter = m_secretWord[i];
-
-            // Reveal all instances of this letter
-            for (int j = 0; j < m_secretWord.length(); ++j) {
-                if (m_secretWord[j] == hintLetter) {
-                    m_currentProgress[j] = hintLetter;
-                }
-            }
+    int i = m_currentProgress.indexOf('_');
+    if (i >= 0) {
+        QChar hintLetter = m_secretWord[i];
+
+        // Reveal all instances of this letter
+        revealLetter(hintLetter);
+        recordGuessedLetter(hintLetter);
 
-            m_guessedLetters.append(hintLetter);
-            break;
+        if (m_eventLog) {
+            m_eventLog->logHint(hintLetter, m_remainingTries);
         }
     }
 }
 
+bool HangmanGame::revealLetter(QChar letter)
+{
+    const QChar* shown = m_currentProgress.constData();
+    QChar* progress = nullptr;
+    QChar* spaced = nullptr;
+    int revealed = 0;
+
+    // Only matching positions are touched, so long phrases stay cheap per guess.
+    // Write access is taken on the first change, so a miss never detaches
+    int matches = forEachMatch(m_secretWord.constData(), m_secretWord.length(), letter,
+                               [&](int i) {
+                                   if (shown[i] == letter) {
+                                       return;
+                                   }
+                                   if (!progress) {
+                                       progress = m_currentProgress.data();
+                                       spaced = m_progressText.data();
+                                       shown = progress;
+                                   }
+                                   progress[i] = letter;
+                                   spaced[2 * i] = letter;
+                                   revealed++;
+                               });
+
+    m_hiddenCount -= revealed;
+    return matches > 0;
+}
+
+void HangmanGame::recordGuessedLetter(QChar letter)
+{
+    m_guessedLetters.append(letter);
+
+    // Capacity is reserved in startNewGame, so appending never reallocates
+    if (!m_guessedText.isEmpty()) {
+        m_guessedText += QLatin1String(", ");
+    }
+    m_guessedText += letter.toUpper();
+}
+
+void HangmanGame::finishGame()
+{
+    m_gameFinished = true;
+
+    // A win is recorded once the player saves it, a loss only for a known player
+    if (!isGameWon() && !m_playerName.isEmpty()) {
+        recordResult(m_playerName, 0);
+    }
+
+    if (m_eventLog) {
+        m_eventLog->logEnd(isGameWon(), m_remainingTries);
+    }
+}
+
 bool HangmanGame::isGameOver() const
 {
     return m_remainingTries <= 0 || isGameWon();
@@ -123,89 +237,86 @@ bool HangmanGame::isGameOver() const
 
 bool HangmanGame::isGameWon() const
 {
-    return !m_currentProgress.contains('_');
+    // Kept up to date by revealLetter, so no rescan of the secret
+    return m_hiddenCount == 0;
 }
 
 QString HangmanGame::getCurrentProgress() const
 {
-    QString spaced;
-    for (int i = 0; i < m_currentProgress.length(); ++i) {
-        if (i > 0) spaced += " ";
-        spaced += m_currentProgress[i];
-    }
-    return spaced;
+    return getProgressView().toString();
 }
 
 QString HangmanGame::getHangmanDrawing() const
 {
     int stage = 7 - m_remainingTries;
 
-    QStringList drawings = {
+    // Literals are static data, so handing one out never allocates
+    static const QString drawings[] = {
         // Stage 0 - Empty
-        "   ______\n"
-        "   |    |\n"
-        "   |\n"
-        "   |\n"
-        "   |\n"
-        "   |\n"
-        "  _|_\n",
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |\n"
+                       "   |\n"
+                       "   |\n"
+                       "   |\n"
+                       "  _|_\n"),
 
         // Stage 1 - Head
-        "   ______\n"
-        "   |    |\n"
-        "   |    O\n"
-        "   |\n"
-        "   |\n"
-        "   |\n"
-        "  _|_\n",
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |    O\n"
+                       "   |\n"
+                       "   |\n"
+                       "   |\n"
+                       "  _|_\n"),
 
         // Stage 2 - Body
-        "   ______\n"
-        "   |    |\n"
-        "   |    O\n"
-        "   |    |\n"
-        "   |\n"
-        "   |\n"
-        "  _|_\n",
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |    O\n"
+                       "   |    |\n"
+                       "   |\n"
+                       "   |\n"
+                       "  _|_\n"),
 
         // Stage 3 - Left arm
-        "   ______\n"
-        "   |    |\n"
-        "   |    O\n"
-        "   |   /|\n"
-        "   |\n"
-        "   |\n"
-        "  _|_\n",
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |    O\n"
+                       "   |   /|\n"
+                       "   |\n"
+                       "   |\n"
+                       "  _|_\n"),
 
         // Stage 4 - Right arm
-        "   ______\n"
-        "   |    |\n"
-        "   |    O\n"
-        "   |   /|\\\n"
-        "   |\n"
-        "   |\n"
-        "  _|_\n",
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |    O\n"
+                       "   |   /|\\\n"
+                       "   |\n"
+                       "   |\n"
+                       "  _|_\n"),
 
         // Stage 5 - Left leg
-        "   ______\n"
-        "   |    |\n"
-        "   |    O\n"
-        "   |   /|\\\n"
-        "   |   /\n"
-        "   |\n"
-        "  _|_\n",
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |    O\n"
+                       "   |   /|\\\n"
+                       "   |   /\n"
+                       "   |\n"
+                       "  _|_\n"),
 
         // Stage 6 - Right leg (Dead)
-        "   ______\n"
-        "   |    |\n"
-        "   |    O\n"
-        "   |   /|\\\n"
-        "   |   / \\\n"
-        "   |\n"
-        "  _|_\n"
+        QStringLiteral("   ______\n"
+                       "   |    |\n"
+                       "   |    O\n"
+                       "   |   /|\\\n"
+                       "   |   / \\\n"
+                       "   |\n"
+                       "  _|_\n")
     };
 
-    if (stage >= 0 && stage < drawings.size()) {
+    if (stage >= 0 && stage < static_cast<int>(std::size(drawings))) {
         return drawings[stage];
     }
     return drawings[0];
@@ -218,12 +329,7 @@ int HangmanGame::getRemainingTries() const
 
 QString HangmanGame::getGuessedLetters() const
 {
-    QString result;
-    for (const QChar& letter : m_guessedLetters) {
-        if (!result.isEmpty()) result += ", ";
-        result += letter.toUpper();
-    }
-    return result;
+    return getGuessedLettersView().toString();
 }
 
 void HangmanGame::saveScore(const QString& playerName, int score)
@@ -235,6 +341,25 @@ void HangmanGame::saveScore(const QString& playerName, int score)
             << score << " out of 7\n";
         file.close();
     }
+
+    recordResult(playerName, score);
+}
+
+void HangmanGame::recordResult(const QString& playerName, int score)
+{
+    if (!m_scoreBoard) {
+        return;
+    }
+
+    // Update aggregates incrementally instead of rescanning the history
+    ScoreBoard::Entry entry;
+    entry.playerName = playerName;
+    entry.score = score;
+    entry.triesUsed = getMaxTries() - m_remainingTries;
+    entry.theme = static_cast<int>(m_currentTheme);
+    entry.timestamp = QDateTime::currentSecsSinceEpoch();
+
+    m_scoreBoard->record(entry);
 }
 
 QStringList HangmanGame::loadScores() const
@@ -255,3 +380,17 @@ QStringList HangmanGame::loadScores() const
 
     return scores;
 }
+
+QString HangmanGame::getThemeName(Theme theme)
+{
+    switch (theme) {
+    case Theme::Animals:   return "Animals";
+    case Theme::Countries: return "Countries";
+    case Theme::Fruits:    return "Fruits";
+    case Theme::Sports:    return "Sports";
+    case Theme::Colors:    return "Colors";
+    case Theme::Phrases:   return "Phrases & Quotes";
+    case Theme::Count:     break;
+    }
+    return "Unknown";
+}
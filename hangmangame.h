@@ -2,12 +2,16 @@
 #define HANGMANGAME_H
 
 #include <QString>
+#include <QStringView>
 #include <QStringList>
 #include <QVector>
-#include <QMap>
 #include <QFile>
 #include <QTextStream>
 #include <QRandomGenerator>
+#include "worddictionary.h"
+
+class GameLog;
+class ScoreBoard;
 
 /**
  * @brief The HangmanGame class encapsulates all game logic
@@ -21,13 +25,18 @@ public:
         Countries,
         Fruits,
         Sports,
-        Colors
+        Colors,
+        Phrases,
+        Count // Number of themes, keep last
     };
+    static constexpr int THEME_COUNT = static_cast<int>(Theme::Count);
 
     HangmanGame();
 
     // Game control
-    void startNewGame(Theme theme);
+    // A named player has losses recorded too, an anonymous one only saved wins
+    void startNewGame(Theme theme, const QString& playerName = QString());
+    void startNewGame(Theme theme, quint32 seed, const QString& playerName = QString());
     bool guessLetter(QChar letter);
     bool isGameOver() const;
     bool isGameWon() const;
@@ -40,21 +49,48 @@ public:
     QString getGuessedLetters() const;
     QString getSecretWord() const { return m_secretWord; }
 
+    // Allocation-free views, valid until the next guess or new game
+    QStringView getProgressView() const { return m_progressText; }
+    QStringView getGuessedLettersView() const { return m_guessedText; }
+
+    QString getPlayerName() const { return m_playerName; }
+    quint32 getSeed() const { return m_seed; }
+    Theme getCurrentTheme() const { return m_currentTheme; }
+    static QString getThemeName(Theme theme);
+
     // Score management
     void saveScore(const QString& playerName, int score);
     QStringList loadScores() const;
 
+    // Statistics (not owned, may be null)
+    void setScoreBoard(ScoreBoard* board) { m_scoreBoard = board; }
+
+    // Event logging (not owned, may be null)
+    void setEventLog(GameLog* log) { m_eventLog = log; }
+
 private:
-    void initializeWordLists();
-    QString selectRandomWord(Theme theme);
+    QString selectRandomWord(Theme theme, quint32 seed);
     void applyHint();
+    void finishGame();
+    void recordResult(const QString& playerName, int score);
+    bool revealLetter(QChar letter);
+    void recordGuessedLetter(QChar letter);
 
-    QMap<Theme, QStringList> m_wordLists;
+    const WordDictionary* m_dictionary; // Shared, never owned
+    Theme m_currentTheme;
+    quint32 m_seed;
     QString m_secretWord;
     QString m_currentProgress;
+    int m_hiddenCount; // Letters still shown as '_'
     QVector<QChar> m_guessedLetters;
+    QString m_progressText; // Spaced progress, e.g. "_ a _ _", see startNewGame
+    QString m_guessedText;  // Uppercase, e.g. "A, E"
     int m_remainingTries;
     bool m_hintUsed;
+    bool m_gameFinished;
+    QString m_playerName; // Empty when the player is not known
+    ScoreBoard* m_scoreBoard;
+    GameLog* m_eventLog;
 
     static const QString SCORES_FILE;
 };
@@ -0,0 +1,80 @@
+#include "labeltextanimation.h"
+#include <QLabel>
+
+LabelTextAnimation::LabelTextAnimation(QLabel* label, Style style, int durationMs,
+                                       AnimationClock* clock, QObject* parent)
+    : Animation(parent)
+    , m_label(label)
+    , m_style(style)
+    , m_durationMs(durationMs)
+    , m_clock(clock)
+    , m_startMs(0)
+{
+}
+
+void LabelTextAnimation::transitionTo(const QString& text)
+{
+    // Start from what is on screen, which may be mid-animation
+    const QString from = m_label->text();
+    if (from.size() != text.size() || text.size() > MAX_ANIMATED_LENGTH) {
+        snapTo(text);
+        return;
+    }
+
+    m_changed.clear();
+    for (int i = 0; i < text.size(); ++i) {
+        if (from[i] != text[i]) {
+            m_changed.append(i);
+        }
+    }
+
+    if (m_changed.isEmpty()) {
+        snapTo(text);
+        return;
+    }
+
+    m_target = text;
+    m_frame = from;
+    m_startMs = m_clock->now();
+    m_clock->start(this);
+}
+
+void LabelTextAnimation::snapTo(const QString& text)
+{
+    m_clock->stop(this);
+    m_changed.clear();
+    m_target = text;
+    m_frame = text;
+    m_label->setText(text);
+}
+
+bool LabelTextAnimation::advance(qint64 nowMs)
+{
+    qint64 elapsed = nowMs - m_startMs;
+    if (elapsed >= m_durationMs) {
+        m_label->setText(m_target);
+        m_changed.clear();
+        return false;
+    }
+
+    // Position k of n settles at (k + 1) / n of the duration
+    const int count = m_changed.size();
+    const int settled = static_cast<int>(elapsed * count / m_durationMs);
+    const int frameIndex = static_cast<int>(elapsed / AnimationClock::FRAME_INTERVAL_MS);
+
+    QString frame = m_frame;
+    for (int k = 0; k < count; ++k) {
+        int pos = m_changed[k];
+        if (k < settled) {
+            frame[pos] = m_target[pos];
+        } else if (m_style == Style::Scramble) {
+            frame[pos] = QChar('a' + (frameIndex + k * 7) % 26);
+        }
+    }
+
+    // Skip the layout and repaint when nothing visible moved this frame
+    if (frame != m_label->text()) {
+        m_label->setText(frame);
+    }
+    return true;
+}
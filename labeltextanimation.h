@@ -0,0 +1,50 @@
+#ifndef LABELTEXTANIMATION_H
+#define LABELTEXTANIMATION_H
+
+#include <QString>
+#include <QVector>
+#include "animationclock.h"
+
+class QLabel;
+
+/**
+ * @brief The LabelTextAnimation class animates a label from one text to another
+ * Only the characters that differ are animated, and the label is only
+ * touched on frames where its text actually changes
+ */
+class LabelTextAnimation : public Animation
+{
+    Q_OBJECT
+
+public:
+    enum class Style {
+        DrawIn,   // Changed characters appear one after another
+        Scramble  // Changed characters cycle through letters, then settle
+    };
+
+    LabelTextAnimation(QLabel* label, Style style, int durationMs,
+                       AnimationClock* clock, QObject* parent = nullptr);
+
+    // Animates when the shape of the text is unchanged and it is short enough,
+    // otherwise jumps
+    void transitionTo(const QString& text);
+    void snapTo(const QString& text);
+
+    bool advance(qint64 nowMs) override;
+
+    // Every frame re-lays out the whole label, so longer texts are not animated
+    static const int MAX_ANIMATED_LENGTH = 256;
+
+private:
+    QLabel* m_label;
+    Style m_style;
+    int m_durationMs;
+    AnimationClock* m_clock;
+
+    QString m_target;
+    QString m_frame;
+    QVector<int> m_changed; // Positions that differ from the starting text
+    qint64 m_startMs;
+};
+
+#endif // LABELTEXTANIMATION_H
@@ -1,8 +1,14 @@
-#include "MainWindow.h"
+#include "mainwindow.h"
+#include "uistressharness.h"
+#include "processstats.h"
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+#include <QTimer>
 
 int main(int argc, char *argv[])
 {
+    ProcessStats::markMainEntered();
     QApplication app(argc, argv);
 
     // Set application metadata
@@ -10,9 +16,47 @@ int main(int argc, char *argv[])
     app.setApplicationVersion("1.0");
     app.setOrganizationName("Hangman Studios");
 
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption stressOption("stress",
+                                    "Play <games> automated games and report input-to-paint latency.",
+                                    "games");
+    parser.addOption(stressOption);
+    QCommandLineOption spectateOption("spectate",
+                                      "Broadcast game state to spectators on local socket <name>.",
+                                      "name");
+    parser.addOption(spectateOption);
+    QCommandLineOption statsOption("stats",
+                                   "Print startup time and peak memory use after the first frame, "
+                                   "and animation frame timing on exit.");
+    parser.addOption(statsOption);
+    parser.process(app);
+
     // Create and show main window
     MainWindow window;
     window.show();
 
-    return app.exec();
+    if (parser.isSet(spectateOption) && !window.enableSpectators(parser.value(spectateOption))) {
+        qWarning("Could not open the spectator channel");
+    }
+
+    if (parser.isSet(statsOption)) {
+        // Paint synchronously so the measurement covers the first frame
+        window.repaint();
+        QTextStream(stdout) << "GUI frontend: " << ProcessStats::describe() << " at first frame\n";
+    }
+
+    if (parser.isSet(stressOption)) {
+        UiStressHarness* harness = new UiStressHarness(&window, parser.value(stressOption).toInt(), &app);
+        QObject::connect(harness, &UiStressHarness::finished, &app, &QApplication::quit);
+        QTimer::singleShot(0, harness, &UiStressHarness::start);
+    }
+
+    int result = app.exec();
+
+    if (parser.isSet(statsOption)) {
+        QTextStream(stdout) << "Animation frames: " << window.describeFrameStats() << "\n";
+    }
+
+    return result;
 }
@@ -1,9 +1,33 @@
-#include "MainWindow.h"
+#include "mainwindow.h"
 #include <QApplication>
+#include <QTextStream>
+
+namespace {
+
+// Pads every line of the drawing to one width so that stages have the same
+// shape, which lets a stage change animate character by character
+QString padDrawing(const QString& drawing)
+{
+    const int width = 12;
+    QStringList lines = drawing.split('\n');
+    for (QString& line : lines) {
+        line = line.leftJustified(width);
+    }
+    return lines.join('\n');
+}
+
+} // namespace
+
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
+    , m_animationClock(new AnimationClock(this))
+    , m_scoreBoard("stats.txt")
+    , m_eventLog("events.log")
+    , m_spectators(nullptr)
     , m_gameActive(false)
 {
+    m_game.setScoreBoard(&m_scoreBoard);
+    m_game.setEventLog(&m_eventLog);
     setupUI();
     setWindowTitle("Hangman Game");
     resize(800, 600);
@@ -13,6 +37,18 @@ MainWindow::~MainWindow()
 {
 }
 
+bool MainWindow::enableSpectators(const QString& serverName)
+{
+    if (!m_spectators) {
+        m_spectators = new SpectatorChannel(this);
+    }
+    if (!m_spectators->listen(serverName)) {
+        qWarning("%s", qPrintable(m_spectators->errorString()));
+        return false;
+    }
+    return true;
+}
+
 void MainWindow::setupUI()
 {
     // Central widget
@@ -52,7 +88,7 @@ void MainWindow::createGameArea()
     m_hangmanLabel->setFont(monoFont);
     m_hangmanLabel->setAlignment(Qt::AlignCenter);
     m_hangmanLabel->setStyleSheet("background-color: #ecf0f1; padding: 10px; border-radius: 5px;");
-    m_hangmanLabel->setText(m_game.getHangmanDrawing());
+    m_hangmanLabel->setText(padDrawing(m_game.getHangmanDrawing()));
     gameLayout->addWidget(m_hangmanLabel);
 
     // Word progress display
@@ -63,8 +99,24 @@ void MainWindow::createGameArea()
     wordFont.setLetterSpacing(QFont::AbsoluteSpacing, 5);
     m_wordProgressLabel->setFont(wordFont);
     m_wordProgressLabel->setAlignment(Qt::AlignCenter);
+    m_wordProgressLabel->setWordWrap(true); // Long phrases wrap between words
     m_wordProgressLabel->setStyleSheet("color: #16a085; padding: 15px;");
-    gameLayout->addWidget(m_wordProgressLabel);
+
+    // Phrases can run to dozens of lines, so they scroll instead of pushing
+    // the controls off the window
+    QScrollArea* progressScroll = new QScrollArea(this);
+    progressScroll->setWidget(m_wordProgressLabel);
+    progressScroll->setWidgetResizable(true);
+    progressScroll->setFrameShape(QFrame::NoFrame);
+    progressScroll->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    progressScroll->setMaximumHeight(QFontMetrics(wordFont).lineSpacing() * 3 + 30);
+    gameLayout->addWidget(progressScroll);
+
+    // Both labels animate on the shared clock
+    m_stageAnimation = new LabelTextAnimation(m_hangmanLabel, LabelTextAnimation::Style::DrawIn,
+                                              350, m_animationClock, this);
+    m_revealAnimation = new LabelTextAnimation(m_wordProgressLabel, LabelTextAnimation::Style::Scramble,
+                                               250, m_animationClock, this);
 
     // Remaining tries
     m_triesLabel = new QLabel("Remaining Tries: 7", this);
@@ -77,6 +129,7 @@ void MainWindow::createGameArea()
 
     // Guessed letters display
     m_guessedLettersLabel = new QLabel("Guessed Letters: None", this);
+    m_guessedLettersLabel->setObjectName("guessedLettersLabel");
     m_guessedLettersLabel->setAlignment(Qt::AlignCenter);
     m_guessedLettersLabel->setStyleSheet("color: #7f8c8d; padding: 5px;");
     gameLayout->addWidget(m_guessedLettersLabel);
@@ -105,12 +158,19 @@ void MainWindow::createControlArea()
     themeLayout->addWidget(themeLabel);
 
     m_themeComboBox = new QComboBox(this);
-    m_themeComboBox->addItem("Animals", static_cast<int>(HangmanGame::Theme::Animals));
-    m_themeComboBox->addItem("Countries", static_cast<int>(HangmanGame::Theme::Countries));
-    m_themeComboBox->addItem("Fruits", static_cast<int>(HangmanGame::Theme::Fruits));
-    m_themeComboBox->addItem("Sports", static_cast<int>(HangmanGame::Theme::Sports));
-    m_themeComboBox->addItem("Colors", static_cast<int>(HangmanGame::Theme::Colors));
+    for (int theme = 0; theme < HangmanGame::THEME_COUNT; ++theme) {
+        m_themeComboBox->addItem(HangmanGame::getThemeName(static_cast<HangmanGame::Theme>(theme)), theme);
+    }
     themeLayout->addWidget(m_themeComboBox);
+
+    // Optional, a named player has losses and streaks tracked as well
+    QLabel* playerLabel = new QLabel("Player:", this);
+    themeLayout->addWidget(playerLabel);
+
+    m_playerNameInput = new QLineEdit(this);
+    m_playerNameInput->setObjectName("playerNameInput");
+    m_playerNameInput->setPlaceholderText("Anonymous");
+    themeLayout->addWidget(m_playerNameInput);
     themeLayout->addStretch();
 
     controlLayout->addLayout(themeLayout);
@@ -121,6 +181,7 @@ void MainWindow::createControlArea()
     inputLayout->addWidget(inputLabel);
 
     m_letterInput = new QLineEdit(this);
+    m_letterInput->setObjectName("letterInput");
     m_letterInput->setMaxLength(1);
     m_letterInput->setPlaceholderText("A-Z");
     m_letterInput->setAlignment(Qt::AlignCenter);
@@ -144,6 +205,7 @@ void MainWindow::createControlArea()
     QHBoxLayout* buttonLayout = new QHBoxLayout();
 
     m_startButton = new QPushButton("Start Game", this);
+    m_startButton->setObjectName("startButton");
     m_startButton->setStyleSheet("background-color: #27ae60; color: white; padding: 10px 20px; font-weight: bold; font-size: 12pt;");
     connect(m_startButton, &QPushButton::clicked, this, &MainWindow::onStartGame);
     buttonLayout->addWidget(m_startButton);
@@ -209,16 +271,17 @@ void MainWindow::onStartGame()
     HangmanGame::Theme theme = static_cast<HangmanGame::Theme>(themeIndex);
 
     // Start new game
-    m_game.startNewGame(theme);
+    m_game.startNewGame(theme, m_playerNameInput->text().trimmed());
     m_gameActive = true;
 
     // Enable game controls
     enableGameControls(true);
 
     // Update display
-    updateDisplay();
+    updateDisplay(false);
     m_statusLabel->setText("Game started! Guess the word!");
     m_letterInput->setFocus();
+    broadcastState();
 }
 
 void MainWindow::onCheckScores()
@@ -228,7 +291,7 @@ void MainWindow::onCheckScores()
     // Create dialog to display scores
     QDialog* scoreDialog = new QDialog(this);
     scoreDialog->setWindowTitle("High Scores");
-    scoreDialog->resize(500, 400);
+    scoreDialog->resize(500, 600);
 
     QVBoxLayout* layout = new QVBoxLayout(scoreDialog);
 
@@ -240,6 +303,15 @@ void MainWindow::onCheckScores()
     titleLabel->setAlignment(Qt::AlignCenter);
     layout->addWidget(titleLabel);
 
+    QTextEdit* statsText = new QTextEdit(scoreDialog);
+    statsText->setReadOnly(true);
+    statsText->setPlainText(formatStatistics());
+    layout->addWidget(statsText);
+
+    QLabel* historyLabel = new QLabel("Score History", scoreDialog);
+    historyLabel->setAlignment(Qt::AlignCenter);
+    layout->addWidget(historyLabel);
+
     QTextEdit* scoreText = new QTextEdit(scoreDialog);
     scoreText->setReadOnly(true);
 
@@ -256,7 +328,62 @@ void MainWindow::onCheckScores()
     connect(closeButton, &QPushButton::clicked, scoreDialog, &QDialog::accept);
     layout->addWidget(closeButton);
 
-    scoreDialog->exec();
+    // Non-modal so the event loop and game timers keep running
+    scoreDialog->setAttribute(Qt::WA_DeleteOnClose);
+    scoreDialog->show();
+}
+
+QString MainWindow::formatStatistics() const
+{
+    const ScoreBoard& board = m_scoreBoard;
+    if (board.getPlayerCount() == 0) {
+        return "No statistics yet.";
+    }
+
+    QString text;
+    QTextStream out(&text);
+
+    auto writeLeaderboard = [&out](const QString& heading,
+                                   const QVector<ScoreBoard::Entry>& entries) {
+        out << heading << "\n";
+        if (entries.isEmpty()) {
+            out << "  (no scores)\n";
+        }
+        for (int i = 0; i < entries.size(); ++i) {
+            out << "  " << (i + 1) << ". " << entries[i].playerName
+                << " - " << entries[i].score << "/7 ("
+                << HangmanGame::getThemeName(static_cast<HangmanGame::Theme>(entries[i].theme))
+                << ")\n";
+        }
+        out << "\n";
+    };
+
+    writeLeaderboard("Top 10 This Week", board.getTopScoresThisWeek());
+    writeLeaderboard("Top 10 All Time", board.getTopScores());
+
+    out << "Average Tries by Theme (a loss counts as 7)\n";
+    for (int theme = 0; theme < HangmanGame::THEME_COUNT; ++theme) {
+        out << "  " << HangmanGame::getThemeName(static_cast<HangmanGame::Theme>(theme)) << ": ";
+        if (board.getGamesRecorded(theme) == 0) {
+            out << "-\n";
+        } else {
+            out << QString::number(board.getAverageTries(theme), 'f', 1)
+                << " (" << board.getGamesRecorded(theme) << " games)\n";
+        }
+    }
+    out << "\n";
+
+    out << "Players\n";
+    QStringList names = board.getPlayerNames();
+    names.sort(Qt::CaseInsensitive);
+    for (const QString& name : names) {
+        const ScoreBoard::PlayerStats* stats = board.findPlayer(name);
+        out << "  " << name << " - best " << stats->bestScore << "/7, "
+            << stats->gamesWon << " wins, " << stats->gamesLost << " losses, streak "
+            << stats->currentStreak << " (best " << stats->bestStreak << ")\n";
+    }
+
+    return text;
 }
 
 void MainWindow::onExit()
@@ -326,6 +453,8 @@ void MainWindow::onGuessLetter()
     if (m_game.isGameOver()) {
         endGame();
     }
+
+    broadcastState();
 }
 
 void MainWindow::onLetterButtonClicked()
@@ -342,13 +471,23 @@ void MainWindow::onLetterButtonClicked()
     onGuessLetter();
 }
 
-void MainWindow::updateDisplay()
+void MainWindow::updateDisplay(bool animate)
 {
-    // Update hangman drawing
-    m_hangmanLabel->setText(m_game.getHangmanDrawing());
+    // The labels get their own copies, so the game's display buffers stay
+    // unshared and are patched in place without detaching
+    const QString drawing = padDrawing(m_game.getHangmanDrawing());
+    const QString progress = m_game.getCurrentProgress();
 
-    // Update word progress
-    m_wordProgressLabel->setText(m_game.getCurrentProgress());
+    if (animate) {
+        // Update hangman drawing
+        m_stageAnimation->transitionTo(drawing);
+
+        // Update word progress
+        m_revealAnimation->transitionTo(progress);
+    } else {
+        m_stageAnimation->snapTo(drawing);
+        m_revealAnimation->snapTo(progress);
+    }
 
     // Update remaining tries with color coding
     int tries = m_game.getRemainingTries();
@@ -371,6 +510,23 @@ void MainWindow::updateDisplay()
     }
 }
 
+AnimationClock::FrameStats MainWindow::getFrameStats() const
+{
+    return m_animationClock->getFrameStats();
+}
+
+QString MainWindow::describeFrameStats() const
+{
+    return m_animationClock->describeFrameStats();
+}
+
+void MainWindow::broadcastState()
+{
+    if (m_spectators) {
+        m_spectators->publishState(m_game, m_statusLabel->text());
+    }
+}
+
 void MainWindow::endGame()
 {
     m_gameActive = false;
@@ -378,9 +534,10 @@ void MainWindow::endGame()
 
     QString message;
     QString title;
+    bool won = m_game.isGameWon();
+    int score = m_game.getRemainingTries();
 
-    if (m_game.isGameWon()) {
-        int score = m_game.getRemainingTries();
+    if (won) {
         title = "Congratulations!";
         message = QString("You won! The word was: %1\nYour score: %2 out of 7")
                       .arg(m_game.getSecretWord().toUpper())
@@ -388,20 +545,6 @@ void MainWindow::endGame()
 
         m_statusLabel->setText("🎉 YOU WON! 🎉");
         m_statusLabel->setStyleSheet("color: #27ae60; padding: 10px; font-weight: bold; font-size: 12pt;");
-
-        // Get player name and save score
-        bool ok;
-        QString playerName = QInputDialog::getText(this, "Enter Your Name",
-                                                   "Congratulations! Enter your name for the scoreboard:",
-                                                   QLineEdit::Normal, "", &ok);
-
-        if (ok && !playerName.isEmpty()) {
-            m_game.saveScore(playerName, score);
-            QMessageBox::information(this, "Score Saved",
-                                     QString("Your score has been saved!\n%1 - Score: %2/7")
-                                         .arg(playerName).arg(score));
-        }
-
     } else {
         title = "Game Over";
         message = QString("You lost! The word was: %1")
@@ -411,11 +554,58 @@ void MainWindow::endGame()
         m_statusLabel->setStyleSheet("color: #e74c3c; padding: 10px; font-weight: bold; font-size: 12pt;");
     }
 
-    QMessageBox msgBox(this);
-    msgBox.setWindowTitle(title);
-    msgBox.setText(message);
-    msgBox.setStandardButtons(QMessageBox::Ok);
-    msgBox.exec();
+    // Dialogs are chained through signals instead of nested exec() calls
+    if (won) {
+        promptForPlayerName(score, title, message);
+    } else {
+        showMessage(title, message);
+    }
+
+    emit gameFinished(won);
+}
+
+void MainWindow::promptForPlayerName(int score, const QString& title, const QString& message)
+{
+    QInputDialog* nameDialog = new QInputDialog(this);
+    nameDialog->setAttribute(Qt::WA_DeleteOnClose);
+    nameDialog->setWindowTitle("Enter Your Name");
+    nameDialog->setLabelText("Congratulations! Enter your name for the scoreboard:");
+    nameDialog->setTextEchoMode(QLineEdit::Normal);
+    nameDialog->setTextValue(m_game.getPlayerName());
+
+    // The score belongs to this game, so hold off the next one until it is saved
+    m_startButton->setEnabled(false);
+
+    connect(nameDialog, &QInputDialog::finished, this, [=](int result) {
+        m_startButton->setEnabled(true);
+
+        QString playerName = nameDialog->textValue();
+        if (result != QDialog::Accepted || playerName.isEmpty()) {
+            showMessage(title, message);
+            return;
+        }
+
+        m_game.saveScore(playerName, score);
+        QMessageBox* savedBox = showMessage("Score Saved",
+                                            QString("Your score has been saved!\n%1 - Score: %2/7")
+                                                .arg(playerName).arg(score));
+        connect(savedBox, &QMessageBox::finished, this, [=]() {
+            showMessage(title, message);
+        });
+    });
+
+    nameDialog->show();
+}
+
+QMessageBox* MainWindow::showMessage(const QString& title, const QString& message)
+{
+    QMessageBox* msgBox = new QMessageBox(this);
+    msgBox->setAttribute(Qt::WA_DeleteOnClose);
+    msgBox->setWindowTitle(title);
+    msgBox->setText(message);
+    msgBox->setStandardButtons(QMessageBox::Ok);
+    msgBox->show();
+    return msgBox;
 }
 
 void MainWindow::enableGameControls(bool enable)
@@ -423,6 +613,7 @@ void MainWindow::enableGameControls(bool enable)
     m_letterInput->setEnabled(enable);
     m_guessButton->setEnabled(enable);
     m_themeComboBox->setEnabled(!enable); // Disable theme selection during game
+    m_playerNameInput->setEnabled(!enable);
 
     // Enable/disable letter buttons
     for (QPushButton* btn : m_letterButtons) {
@@ -13,7 +13,13 @@
 #include <QMessageBox>
 #include <QInputDialog>
 #include <QFont>
-#include "HangmanGame.h"
+#include <QScrollArea>
+#include "hangmangame.h"
+#include "scoreboard.h"
+#include "gamelog.h"
+#include "spectatorchannel.h"
+#include "animationclock.h"
+#include "labeltextanimation.h"
 
 /**
  * @brief The MainWindow class handles all UI interactions
@@ -27,6 +33,18 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
+    // Starts broadcasting game state to local spectators
+    bool enableSpectators(const QString& serverName);
+
+    // Frame timing of the stage and letter-reveal animations
+    AnimationClock::FrameStats getFrameStats() const;
+    QString describeFrameStats() const;
+    bool isAnimating() const { return m_animationClock->isRunning(); }
+
+signals:
+    // Emitted once a game ends, before any end-of-game dialog is answered
+    void gameFinished(bool won);
+
 private slots:
     // Button handlers
     void onStartGame();
@@ -44,10 +62,14 @@ private:
     void createLetterButtons();
 
     // Game update methods
-    void updateDisplay();
+    void updateDisplay(bool animate = true);
     void resetGame();
     void endGame();
+    void promptForPlayerName(int score, const QString& title, const QString& message);
+    QMessageBox* showMessage(const QString& title, const QString& message);
     void enableGameControls(bool enable);
+    void broadcastState();
+    QString formatStatistics() const;
 
     // UI Components
     QWidget* m_centralWidget;
@@ -60,8 +82,14 @@ private:
     QLabel* m_guessedLettersLabel;
     QLabel* m_statusLabel;
 
+    // Animations
+    AnimationClock* m_animationClock;
+    LabelTextAnimation* m_stageAnimation;
+    LabelTextAnimation* m_revealAnimation;
+
     // Control area
     QComboBox* m_themeComboBox;
+    QLineEdit* m_playerNameInput;
     QPushButton* m_startButton;
     QPushButton* m_scoresButton;
     QPushButton* m_exitButton;
@@ -73,7 +101,10 @@ private:
     QVector<QPushButton*> m_letterButtons;
 
     // Game logic
+    ScoreBoard m_scoreBoard; // Shared by every game played in this window
     HangmanGame m_game;
+    GameLog m_eventLog;
+    SpectatorChannel* m_spectators;
     bool m_gameActive;
 };
 
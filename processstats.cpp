@@ -0,0 +1,61 @@
+#include "processstats.h"
+#include <QElapsedTimer>
+#include <QFile>
+
+#if defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace {
+QElapsedTimer g_sinceMain;
+}
+
+void ProcessStats::markMainEntered()
+{
+    g_sinceMain.start();
+}
+
+qint64 ProcessStats::getStartupMs()
+{
+#if defined(Q_OS_LINUX)
+    // Field 22 of /proc/self/stat is the start time in clock ticks since boot,
+    // which includes the dynamic loading that happens before main
+    QFile stat("/proc/self/stat");
+    timespec now;
+    if (stat.open(QIODevice::ReadOnly) && clock_gettime(CLOCK_BOOTTIME, &now) == 0) {
+        const QByteArray line = stat.readAll();
+        const QList<QByteArray> fields = line.mid(line.lastIndexOf(')') + 2).split(' ');
+        if (fields.size() > 19) {
+            qint64 startMs = fields[19].toLongLong() * 1000 / sysconf(_SC_CLK_TCK);
+            qint64 nowMs = static_cast<qint64>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+            return nowMs - startMs;
+        }
+    }
+#endif
+    return g_sinceMain.isValid() ? g_sinceMain.elapsed() : -1;
+}
+
+qint64 ProcessStats::getPeakRssKb()
+{
+#if defined(Q_OS_UNIX)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(Q_OS_MACOS)
+        return usage.ru_maxrss / 1024; // Reported in bytes
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return -1;
+}
+
+QString ProcessStats::describe()
+{
+    qint64 rssKb = getPeakRssKb();
+    return QString("startup %1 ms, peak RSS %2")
+        .arg(getStartupMs())
+        .arg(rssKb < 0 ? QString("n/a") : QString("%1 KB").arg(rssKb));
+}
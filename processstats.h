@@ -0,0 +1,26 @@
+#ifndef PROCESSSTATS_H
+#define PROCESSSTATS_H
+
+#include <QString>
+
+/**
+ * @brief The ProcessStats class reports startup time and memory use
+ * Used by both frontends' --stats option so their footprints can be compared
+ */
+class ProcessStats
+{
+public:
+    // Call first thing in main, as the fallback startup reference
+    static void markMainEntered();
+
+    // Milliseconds since the process was created, or since main when the
+    // OS does not report a creation time
+    static qint64 getStartupMs();
+
+    // Peak resident set size in KB, or -1 when unavailable
+    static qint64 getPeakRssKb();
+
+    static QString describe();
+};
+
+#endif // PROCESSSTATS_H
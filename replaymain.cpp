@@ -0,0 +1,256 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QVector>
+#include <algorithm>
+#include "hangmangame.h"
+#include "gamelog.h"
+#include "allocationcounter.h"
+
+/**
+ * Replays an event log written by GameLog through HangmanGame as fast as
+ * possible, checking the game state after every event and reporting how
+ * long each kind of event took to process. On glibc it also counts heap
+ * allocations made while applying a guess and reading back the state a
+ * frontend renders, which should be zero.
+ *
+ * With --check-allocations no log is needed: seeded games are played with
+ * a GameLog attached, and the tool fails if any guess after warm-up
+ * allocates.
+ *
+ * Usage: HangmanReplay [--check-allocations] [events.log]
+ */
+
+namespace {
+
+struct Timings {
+    QVector<qint64> samples;
+
+    void report(QTextStream& out, const QString& name, const QString& unit) const
+    {
+        if (samples.isEmpty()) {
+            out << "  " << name << ": no samples\n";
+            return;
+        }
+
+        QVector<qint64> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&sorted](double p) {
+            int index = static_cast<int>(p * (sorted.size() - 1));
+            return sorted[index];
+        };
+
+        qint64 total = 0;
+        for (qint64 value : sorted) {
+            total += value;
+        }
+
+        out << "  " << name << " (" << sorted.size() << " events, " << unit << "): "
+            << "mean " << total / sorted.size()
+            << "  p50 " << percentile(0.50)
+            << "  p99 " << percentile(0.99)
+            << "  max " << sorted.last() << "\n";
+    }
+};
+
+const int CHECK_GAMES = 300;
+const int WARM_UP_GAMES = 5;
+
+int checkAllocations(QTextStream& out)
+{
+    if (!AllocationCounter::isAvailable()) {
+        out << "Heap allocations cannot be counted on this platform\n";
+        return 2;
+    }
+
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        out << "Cannot create a directory for the event log\n";
+        return 2;
+    }
+
+    // Logging is part of every guess in the frontends, so it is measured too
+    GameLog log(dir.filePath("events.log"));
+    HangmanGame game;
+    game.setEventLog(&log);
+
+    // Most frequent letters first, so games end both ways
+    const QString letters = QStringLiteral("etaoinshrdlcumwfgypbvkjxqz");
+    int guessCount = 0;
+    int failedGuesses = 0;
+    quint64 totalAllocations = 0;
+
+    for (int round = 0; round < CHECK_GAMES; ++round) {
+        auto theme = static_cast<HangmanGame::Theme>(round % HangmanGame::THEME_COUNT);
+        quint32 seed = static_cast<quint32>(round);
+        game.startNewGame(theme, seed);
+
+        for (int i = 0; i < letters.size() && !game.isGameOver(); ++i) {
+            quint64 before = AllocationCounter::count();
+            game.guessLetter(letters[i]);
+            game.getProgressView();
+            game.getGuessedLettersView();
+            game.getHangmanDrawing();
+            quint64 allocations = AllocationCounter::count() - before;
+
+            // Warm-up games let lazily created state settle before counting
+            if (round < WARM_UP_GAMES) {
+                continue;
+            }
+
+            guessCount++;
+            if (allocations > 0) {
+                totalAllocations += allocations;
+                if (failedGuesses++ < 10) {
+                    out << "  " << allocations << " allocations guessing '" << letters[i]
+                        << "' in " << HangmanGame::getThemeName(theme) << " game " << seed << "\n";
+                }
+            }
+        }
+    }
+
+    out << "Allocation check: " << guessCount << " guesses in " << CHECK_GAMES - WARM_UP_GAMES
+        << " games after " << WARM_UP_GAMES << " warm-up games, " << totalAllocations
+        << " heap allocations in " << failedGuesses << " guesses\n";
+    return failedGuesses == 0 ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addPositionalArgument("log", "Event log to replay, events.log by default.", "[log]");
+    QCommandLineOption checkOption("check-allocations",
+                                   "Play seeded games with logging enabled and fail if a guess "
+                                   "allocates after warm-up.");
+    parser.addOption(checkOption);
+    parser.process(app);
+
+    if (parser.isSet(checkOption)) {
+        return checkAllocations(out);
+    }
+
+    const QStringList arguments = parser.positionalArguments();
+    const QString fileName = arguments.isEmpty() ? QString("events.log") : arguments.first();
+    GameLogReader reader(fileName);
+    if (!reader.isValid()) {
+        out << "Cannot read event log: " << fileName << "\n";
+        return 2;
+    }
+
+    HangmanGame game;
+    GameEvent event;
+    QElapsedTimer timer;
+    QElapsedTimer wallClock;
+
+    Timings startTimes;
+    Timings guessTimes;
+    Timings thinkTimes;
+    int eventCount = 0;
+    int gameCount = 0;
+    int mismatches = 0;
+    bool inSync = false;
+    bool found = false;
+    qint64 elapsedNs = 0;
+    quint64 allocationsBefore = 0;
+    quint64 guessAllocations = 0;
+
+    auto mismatch = [&](const QString& what) {
+        out << "Mismatch in game " << gameCount << ", event " << eventCount << ": " << what << "\n";
+        mismatches++;
+        inSync = false; // Skip the rest of this game
+    };
+
+    wallClock.start();
+    while (reader.readNext(event)) {
+        eventCount++;
+
+        switch (event.type) {
+        case GameEvent::Type::Start:
+            gameCount++;
+            inSync = true;
+            timer.start();
+            game.startNewGame(event.theme, event.seed);
+            startTimes.samples.append(timer.nsecsElapsed());
+
+            if (game.getSecretWord() != event.word) {
+                mismatch(QString("word '%1', expected '%2'").arg(game.getSecretWord(), event.word));
+            }
+            break;
+
+        case GameEvent::Type::Guess:
+            if (!inSync) break;
+            thinkTimes.samples.append(static_cast<qint64>(event.elapsedUs));
+
+            allocationsBefore = AllocationCounter::count();
+            timer.start();
+            found = game.guessLetter(event.letter);
+            elapsedNs = timer.nsecsElapsed();
+
+            // Everything a frontend reads back to render the new state
+            game.getProgressView();
+            game.getGuessedLettersView();
+            game.getHangmanDrawing();
+            guessAllocations += AllocationCounter::count() - allocationsBefore;
+
+            guessTimes.samples.append(elapsedNs);
+
+            if (found != event.found) {
+                mismatch(QString("guess '%1' result differs").arg(event.letter));
+            } else if (game.getRemainingTries() != event.remainingTries) {
+                mismatch(QString("%1 tries left, expected %2")
+                             .arg(game.getRemainingTries()).arg(event.remainingTries));
+            }
+            break;
+
+        case GameEvent::Type::Hint:
+            // The hint is applied inside the preceding guessLetter call
+            if (!inSync) break;
+            if (!game.getCurrentProgress().contains(event.letter)) {
+                mismatch(QString("hint '%1' was not revealed").arg(event.letter));
+            }
+            break;
+
+        case GameEvent::Type::End:
+            if (!inSync) break;
+            if (!game.isGameOver() || game.isGameWon() != event.won) {
+                mismatch(QString("game should have ended as a %1").arg(event.won ? "win" : "loss"));
+            }
+            break;
+        }
+    }
+    qint64 wallNs = wallClock.nsecsElapsed();
+
+    if (reader.hasError()) {
+        out << "Warning: log is truncated or corrupt after event " << eventCount << "\n";
+    }
+
+    out << "Replayed " << eventCount << " events from " << gameCount << " games in "
+        << wallNs / 1000 << " us\n";
+    out << "Replay timings:\n";
+    startTimes.report(out, "start", "ns");
+    guessTimes.report(out, "guess", "ns");
+    out << "Recorded player timings:\n";
+    thinkTimes.report(out, "time to guess", "us");
+
+    if (guessTimes.samples.isEmpty()) {
+        out << "Heap allocations during guesses: no guesses replayed, nothing checked\n";
+    } else if (AllocationCounter::isAvailable()) {
+        out << "Heap allocations during guesses: " << guessAllocations << "\n";
+    } else {
+        out << "Heap allocations during guesses: not counted on this platform\n";
+    }
+
+    out << (mismatches == 0 ? "All events verified\n"
+                            : QString("%1 mismatches\n").arg(mismatches));
+
+    bool verified = mismatches == 0 && guessAllocations == 0 && !guessTimes.samples.isEmpty();
+    return verified ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+#include "scoreboard.h"
+#include <QFile>
+#include <QTextStream>
+#include <QDateTime>
+#include <algorithm>
+
+ScoreBoard::ScoreBoard(const QString& fileName)
+    : m_fileName(fileName)
+    , m_weekKey(0)
+{
+    std::fill(std::begin(m_themeGames), std::end(m_themeGames), 0);
+    std::fill(std::begin(m_themeTries), std::end(m_themeTries), 0);
+    load();
+}
+
+void ScoreBoard::record(const Entry& entry)
+{
+    apply(entry);
+    append(entry);
+}
+
+void ScoreBoard::apply(const Entry& entry)
+{
+    // Per-theme averages, a loss counts as every try used
+    if (entry.theme >= 0 && entry.theme < THEME_COUNT) {
+        m_themeGames[entry.theme]++;
+        m_themeTries[entry.theme] += entry.triesUsed;
+    }
+
+    // Per-player record, streaks are counted per player in recording order
+    PlayerStats& stats = m_players[entry.playerName];
+    if (entry.score <= 0) {
+        stats.gamesLost++;
+        stats.currentStreak = 0;
+        return;
+    }
+
+    stats.gamesWon++;
+    stats.totalScore += entry.score;
+    stats.bestScore = qMax(stats.bestScore, entry.score);
+    stats.currentStreak++;
+    stats.bestStreak = qMax(stats.bestStreak, stats.currentStreak);
+
+    // All-time leaderboard
+    pushBounded(m_topScores, entry);
+
+    // Weekly leaderboard restarts when a newer week begins
+    int key = weekKey(entry.timestamp);
+    if (key > m_weekKey) {
+        m_weekKey = key;
+        m_weekScores.clear();
+    }
+    if (key == m_weekKey) {
+        pushBounded(m_weekScores, entry);
+    }
+}
+
+void ScoreBoard::load()
+{
+    QFile file(m_fileName);
+    if (m_fileName.isEmpty() || !file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return;
+    }
+
+    // Format: timestamp <TAB> name <TAB> theme <TAB> score <TAB> tries <TAB> streak
+    // The streak column is informational, streaks are rebuilt from the history
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        const QStringList fields = in.readLine().split('\t');
+        if (fields.size() != 6) {
+            continue;
+        }
+
+        Entry entry;
+        entry.timestamp = fields[0].toLongLong();
+        entry.playerName = fields[1];
+        entry.theme = fields[2].toInt();
+        entry.score = fields[3].toInt();
+        entry.triesUsed = fields[4].toInt();
+        apply(entry);
+    }
+    file.close();
+}
+
+void ScoreBoard::append(const Entry& entry) const
+{
+    const PlayerStats* stats = findPlayer(entry.playerName);
+    int streak = stats ? stats->currentStreak : 0;
+
+    QFile file(m_fileName);
+    if (!m_fileName.isEmpty() && file.open(QIODevice::Append | QIODevice::Text)) {
+        QString name = entry.playerName;
+        name.replace('\t', ' ').replace('\n', ' ');
+
+        QTextStream out(&file);
+        out << entry.timestamp << '\t' << name << '\t' << entry.theme << '\t'
+            << entry.score << '\t' << entry.triesUsed << '\t' << streak << '\n';
+        file.close();
+    }
+}
+
+const ScoreBoard::PlayerStats* ScoreBoard::findPlayer(const QString& playerName) const
+{
+    auto it = m_players.constFind(playerName);
+    return it != m_players.constEnd() ? &it.value() : nullptr;
+}
+
+int ScoreBoard::getGamesRecorded(int theme) const
+{
+    if (theme < 0 || theme >= THEME_COUNT) {
+        return 0;
+    }
+    return m_themeGames[theme];
+}
+
+double ScoreBoard::getAverageTries(int theme) const
+{
+    if (getGamesRecorded(theme) == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(m_themeTries[theme]) / m_themeGames[theme];
+}
+
+QVector<ScoreBoard::Entry> ScoreBoard::getTopScores() const
+{
+    return sortedCopy(m_topScores);
+}
+
+QVector<ScoreBoard::Entry> ScoreBoard::getTopScoresThisWeek() const
+{
+    if (m_weekKey != weekKey(QDateTime::currentSecsSinceEpoch())) {
+        return QVector<Entry>(); // Nothing recorded this week yet
+    }
+    return sortedCopy(m_weekScores);
+}
+
+bool ScoreBoard::ranksAbove(const Entry& a, const Entry& b)
+{
+    // Higher score wins, earlier achievement breaks ties
+    if (a.score != b.score) {
+        return a.score > b.score;
+    }
+    return a.timestamp < b.timestamp;
+}
+
+int ScoreBoard::weekKey(qint64 timestamp)
+{
+    int year = 0;
+    int week = QDateTime::fromSecsSinceEpoch(timestamp).date().weekNumber(&year);
+    return year * 100 + week;
+}
+
+void ScoreBoard::pushBounded(std::vector<Entry>& heap, const Entry& entry)
+{
+    if (static_cast<int>(heap.size()) < TOP_K) {
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end(), ranksAbove);
+    } else if (ranksAbove(entry, heap.front())) {
+        // Evict the weakest entry on the board
+        std::pop_heap(heap.begin(), heap.end(), ranksAbove);
+        heap.back() = entry;
+        std::push_heap(heap.begin(), heap.end(), ranksAbove);
+    }
+}
+
+QVector<ScoreBoard::Entry> ScoreBoard::sortedCopy(const std::vector<Entry>& heap)
+{
+    QVector<Entry> sorted(heap.begin(), heap.end());
+    std::sort(sorted.begin(), sorted.end(), ranksAbove);
+    return sorted;
+}
@@ -0,0 +1,75 @@
+#ifndef SCOREBOARD_H
+#define SCOREBOARD_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+#include <vector>
+#include "hangmangame.h"
+
+/**
+ * @brief The ScoreBoard class aggregates saved scores into statistics
+ * Every recorded score updates the aggregates in place, so queries never
+ * rescan the score history. One board is shared by all games of a frontend
+ */
+class ScoreBoard
+{
+public:
+    static constexpr int THEME_COUNT = HangmanGame::THEME_COUNT;
+    static constexpr int TOP_K = 10;
+
+    struct Entry {
+        QString playerName;
+        int score = 0;
+        int triesUsed = 0;
+        int theme = 0;
+        qint64 timestamp = 0; // Seconds since epoch
+    };
+
+    struct PlayerStats {
+        int gamesWon = 0;
+        int gamesLost = 0;
+        int bestScore = 0;
+        int totalScore = 0;
+        int currentStreak = 0;
+        int bestStreak = 0;
+    };
+
+    // Loads the history from fileName, if given, and appends every new record to it
+    explicit ScoreBoard(const QString& fileName = QString());
+
+    // Recording - an entry with a score of 0 is a loss and ends the player's streak
+    void record(const Entry& entry);
+
+    // Queries - O(1) lookups, leaderboards are O(K log K) with K = TOP_K
+    const PlayerStats* findPlayer(const QString& playerName) const;
+    QStringList getPlayerNames() const { return m_players.keys(); }
+    int getPlayerCount() const { return m_players.size(); }
+    int getGamesRecorded(int theme) const;
+    double getAverageTries(int theme) const;
+    QVector<Entry> getTopScores() const;
+    QVector<Entry> getTopScoresThisWeek() const;
+
+private:
+    void apply(const Entry& entry);
+    void load();
+    void append(const Entry& entry) const;
+
+    static bool ranksAbove(const Entry& a, const Entry& b);
+    static int weekKey(qint64 timestamp);
+    static void pushBounded(std::vector<Entry>& heap, const Entry& entry);
+    static QVector<Entry> sortedCopy(const std::vector<Entry>& heap);
+
+    QString m_fileName;
+    QHash<QString, PlayerStats> m_players;
+    int m_themeGames[THEME_COUNT];
+    int m_themeTries[THEME_COUNT];
+
+    // Bounded min-heaps: the front is the weakest entry still on the board
+    std::vector<Entry> m_topScores;
+    std::vector<Entry> m_weekScores;
+    int m_weekKey;
+};
+
+#endif // SCOREBOARD_H
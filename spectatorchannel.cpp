@@ -0,0 +1,162 @@
+#include "spectatorchannel.h"
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QTimer>
+
+SpectatorChannel::SpectatorChannel(QObject* parent)
+    : QObject(parent)
+    , m_server(new QLocalServer(this))
+    , m_stallTimer(new QTimer(this))
+    , m_sequence(0)
+{
+    m_server->setMaxPendingConnections(1024);
+    connect(m_server, &QLocalServer::newConnection, this, &SpectatorChannel::onNewConnection);
+
+    // Stalled subscribers are dropped even while no new state is published
+    m_stallTimer->setInterval(1000);
+    connect(m_stallTimer, &QTimer::timeout, this, &SpectatorChannel::dropStalled);
+}
+
+bool SpectatorChannel::listen(const QString& serverName)
+{
+    // A live instance answers; only a socket file nobody answers on is stale
+    QLocalSocket probe;
+    probe.connectToServer(serverName);
+    if (probe.waitForConnected(250)) {
+        probe.abort();
+        m_errorString = QString("Another instance is already broadcasting as '%1'").arg(serverName);
+        return false;
+    }
+
+    // Clear a socket file left behind by a crashed instance
+    QLocalServer::removeServer(serverName);
+    bool listening = m_server->listen(serverName);
+    m_errorString = listening ? QString() : m_server->errorString();
+    return listening;
+}
+
+QString SpectatorChannel::errorString() const
+{
+    return m_errorString;
+}
+
+void SpectatorChannel::publishState(const HangmanGame& game, const QString& status)
+{
+    // The secret word is never sent, only what the player can see
+    QJsonObject state;
+    state["sequence"] = static_cast<qint64>(++m_sequence);
+    state["theme"] = HangmanGame::getThemeName(game.getCurrentTheme());
+    state["progress"] = game.getCurrentProgress();
+    state["remainingTries"] = game.getRemainingTries();
+    state["guessedLetters"] = game.getGuessedLetters();
+    state["gameOver"] = game.isGameOver();
+    state["won"] = game.isGameWon();
+    state["status"] = status;
+
+    m_lastFrame = QJsonDocument(state).toJson(QJsonDocument::Compact);
+    m_lastFrame.append('\n');
+
+    for (auto it = m_subscribers.begin(); it != m_subscribers.end(); ++it) {
+        QLocalSocket* socket = it.key();
+        Subscriber& subscriber = it.value();
+
+        if (!isBehind(socket)) {
+            send(socket, subscriber, m_lastFrame);
+            continue;
+        }
+
+        // Coalesce: a newer snapshot replaces the one still waiting
+        subscriber.pending = m_lastFrame;
+        if (!subscriber.behindSince.isValid()) {
+            subscriber.behindSince.start();
+        }
+    }
+
+    dropStalled();
+}
+
+void SpectatorChannel::dropStalled()
+{
+    QList<QLocalSocket*> dropped;
+    for (auto it = m_subscribers.cbegin(); it != m_subscribers.cend(); ++it) {
+        const QElapsedTimer& behindSince = it.value().behindSince;
+        if (behindSince.isValid() && behindSince.elapsed() > DROP_AFTER_MS) {
+            dropped.append(it.key());
+        }
+    }
+
+    // Aborting emits disconnected, so do it outside the iteration
+    for (QLocalSocket* socket : dropped) {
+        socket->abort();
+    }
+}
+
+void SpectatorChannel::onNewConnection()
+{
+    while (QLocalSocket* socket = m_server->nextPendingConnection()) {
+        // Spectators only listen; stop reading anything they send
+        socket->setReadBufferSize(1);
+
+        connect(socket, &QLocalSocket::bytesWritten, this, &SpectatorChannel::onBytesWritten);
+        connect(socket, &QLocalSocket::disconnected, this, &SpectatorChannel::onDisconnected);
+
+        Subscriber& subscriber = m_subscribers[socket];
+        if (!m_lastFrame.isEmpty()) {
+            send(socket, subscriber, m_lastFrame); // Late joiners start from the current state
+        }
+    }
+
+    if (!m_subscribers.isEmpty() && !m_stallTimer->isActive()) {
+        m_stallTimer->start();
+    }
+}
+
+void SpectatorChannel::onBytesWritten()
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(sender());
+    auto it = m_subscribers.find(socket);
+    if (it == m_subscribers.end() || isBehind(socket)) {
+        return;
+    }
+
+    // Caught up: hand over the newest frame it missed, if any
+    Subscriber& subscriber = it.value();
+    subscriber.behindSince.invalidate();
+    if (!subscriber.pending.isEmpty()) {
+        QByteArray frame = subscriber.pending;
+        subscriber.pending.clear();
+        send(socket, subscriber, frame);
+    }
+}
+
+void SpectatorChannel::onDisconnected()
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(sender());
+    if (m_subscribers.remove(socket) > 0) {
+        socket->deleteLater();
+    }
+
+    if (m_subscribers.isEmpty()) {
+        m_stallTimer->stop();
+    }
+}
+
+bool SpectatorChannel::isBehind(QLocalSocket* socket) const
+{
+    return socket->bytesToWrite() > MAX_QUEUED_BYTES;
+}
+
+void SpectatorChannel::send(QLocalSocket* socket, Subscriber& subscriber, const QByteArray& frame)
+{
+    // The frame is encoded once for everyone; only the socket's own write
+    // buffer holds bytes per subscriber, and isBehind() keeps that bounded
+    subscriber.behindSince.invalidate();
+    socket->write(frame);
+
+    // The stall clock starts when a write leaves it behind, not at the next publish
+    if (isBehind(socket)) {
+        subscriber.behindSince.start();
+    }
+}
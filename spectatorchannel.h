@@ -0,0 +1,62 @@
+#ifndef SPECTATORCHANNEL_H
+#define SPECTATORCHANNEL_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QString>
+#include "hangmangame.h"
+
+class QLocalServer;
+class QLocalSocket;
+class QTimer;
+
+/**
+ * @brief The SpectatorChannel class broadcasts game state to local spectators
+ * Each state change is encoded once into an implicitly shared QByteArray
+ * that is handed to every subscriber socket. A subscriber that falls behind
+ * only holds a reference to the newest frame, and is dropped if it stays
+ * behind, so spectators can never slow the game down
+ */
+class SpectatorChannel : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SpectatorChannel(QObject* parent = nullptr);
+
+    bool listen(const QString& serverName);
+    QString errorString() const;
+    int getSubscriberCount() const { return m_subscribers.size(); }
+
+    // Encodes the state once, as one line of JSON, and fans it out
+    void publishState(const HangmanGame& game, const QString& status);
+
+private slots:
+    void onNewConnection();
+    void onBytesWritten();
+    void onDisconnected();
+    void dropStalled();
+
+private:
+    struct Subscriber {
+        QByteArray pending;          // Newest frame not yet queued, if behind
+        QElapsedTimer behindSince;   // Valid while the subscriber is behind
+    };
+
+    bool isBehind(QLocalSocket* socket) const;
+    void send(QLocalSocket* socket, Subscriber& subscriber, const QByteArray& frame);
+
+    QLocalServer* m_server;
+    QTimer* m_stallTimer; // Runs while anyone is subscribed
+    QString m_errorString;
+    QHash<QLocalSocket*, Subscriber> m_subscribers;
+    QByteArray m_lastFrame;
+    quint64 m_sequence;
+
+    static const qint64 MAX_QUEUED_BYTES = 64 * 1024;
+    static const qint64 DROP_AFTER_MS = 5000;
+};
+
+#endif // SPECTATORCHANNEL_H
@@ -0,0 +1,32 @@
+#include "terminalwindow.h"
+#include "processstats.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+
+int main(int argc, char *argv[])
+{
+    ProcessStats::markMainEntered();
+    QCoreApplication app(argc, argv);
+
+    // Set application metadata
+    app.setApplicationName("Hangman Game");
+    app.setApplicationVersion("1.0");
+    app.setOrganizationName("Hangman Studios");
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption statsOption("stats", "Print startup time and peak memory use on exit.");
+    parser.addOption(statsOption);
+    parser.process(app);
+
+    TerminalWindow window;
+    int result = window.run();
+
+    if (parser.isSet(statsOption)) {
+        QTextStream(stdout) << "Terminal frontend: " << window.getFirstFrameStats()
+                            << " at first frame\n";
+    }
+
+    return result;
+}
@@ -0,0 +1,462 @@
+#include "terminalwindow.h"
+#include "processstats.h"
+#include <QByteArray>
+#include <QTextStream>
+#include <cstdio>
+
+#if defined(Q_OS_UNIX)
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int KEY_ESCAPE = 27;
+const int KEY_EOF = -1;
+const int KEY_RESIZE = -2;   // The terminal changed size
+const int KEY_SEQUENCE = -3; // Arrow, function and other escape-sequence keys
+
+#if defined(Q_OS_UNIX)
+termios g_savedMode;
+bool g_rawModeActive = false;
+volatile sig_atomic_t g_resized = 0;
+
+void onResize(int)
+{
+    g_resized = 1;
+}
+
+// Reads one byte if it arrives within timeoutMs, otherwise returns -1
+int readByteWithin(int timeoutMs)
+{
+    pollfd input = { STDIN_FILENO, POLLIN, 0 };
+    unsigned char c = 0;
+    if (poll(&input, 1, timeoutMs) == 1 && read(STDIN_FILENO, &c, 1) == 1) {
+        return c;
+    }
+    return -1;
+}
+
+void restoreTerminal()
+{
+    if (g_rawModeActive) {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &g_savedMode);
+        g_rawModeActive = false;
+    }
+}
+
+void onInterrupt(int)
+{
+    // Leave the shell usable: cooked mode, cursor visible
+    restoreTerminal();
+    const char showCursor[] = "\x1b[?25h\n";
+    ssize_t ignored = write(STDOUT_FILENO, showCursor, sizeof(showCursor) - 1);
+    Q_UNUSED(ignored);
+    _exit(130);
+}
+#endif
+
+void writeOut(const QByteArray& bytes)
+{
+    fwrite(bytes.constData(), 1, static_cast<size_t>(bytes.size()), stdout);
+    fflush(stdout);
+}
+
+} // namespace
+
+TerminalWindow::TerminalWindow()
+    : m_scoreBoard("stats.txt")
+    , m_eventLog("events.log")
+    , m_mode(Mode::Menu)
+    , m_status("Welcome! Pick a theme to begin.")
+    , m_running(true)
+    , m_width(80)
+    , m_height(24)
+{
+    m_game.setScoreBoard(&m_scoreBoard);
+    m_game.setEventLog(&m_eventLog);
+}
+
+TerminalWindow::~TerminalWindow()
+{
+    restoreMode();
+}
+
+int TerminalWindow::run()
+{
+#if defined(Q_OS_UNIX)
+    std::signal(SIGINT, onInterrupt);
+    std::signal(SIGTERM, onInterrupt);
+
+    // Without SA_RESTART a resize interrupts the blocking read, so it redraws at once
+    struct sigaction resize = {};
+    resize.sa_handler = onResize;
+    sigemptyset(&resize.sa_mask);
+    sigaction(SIGWINCH, &resize, nullptr);
+#endif
+
+    m_width = queryWidth();
+    m_height = queryHeight();
+    enableRawMode();
+    resetScreen();
+    render();
+    m_firstFrameStats = ProcessStats::describe();
+
+    while (m_running) {
+        int key = readKey();
+        if (key == KEY_EOF) {
+            break;
+        }
+        if (key == KEY_RESIZE) {
+            m_width = queryWidth();
+            m_height = queryHeight();
+            resetScreen();
+        } else {
+            handleKey(key);
+        }
+        render();
+    }
+
+    // Leave the cursor below the last frame
+    writeOut(QByteArray("\x1b[") + QByteArray::number(m_screen.size() + 1) + ";1H\x1b[?25h");
+    restoreMode();
+    return 0;
+}
+
+void TerminalWindow::handleKey(int key)
+{
+    switch (m_mode) {
+    case Mode::Menu:
+        if (key == KEY_SEQUENCE) {
+            break;
+        } else if (key >= '1' && key < '1' + HangmanGame::THEME_COUNT) {
+            startGame(static_cast<HangmanGame::Theme>(key - '1'));
+        } else if (key == 'n' || key == 'N') {
+            m_playerName = readLine("Player name, tracks losses and streaks too (blank for anonymous): ");
+            m_status = m_playerName.isEmpty() ? QString("Playing anonymously.")
+                                              : QString("Playing as %1.").arg(m_playerName);
+        } else if (key == 'q' || key == 'Q' || key == KEY_ESCAPE) {
+            m_running = false;
+        }
+        break;
+
+    case Mode::Playing:
+        if (key == KEY_SEQUENCE) {
+            break; // Arrow and function keys do nothing while playing
+        } else if (key == KEY_ESCAPE) {
+            m_mode = Mode::Menu;
+            m_status = "Game abandoned.";
+        } else if (key < 128 && QChar(key).isLetter()) {
+            guessLetter(QChar(key));
+        } else {
+            m_status = "Only letters (A-Z) are allowed!";
+        }
+        break;
+
+    case Mode::GameOver:
+        m_mode = Mode::Menu;
+        break;
+    }
+}
+
+void TerminalWindow::startGame(HangmanGame::Theme theme)
+{
+    m_game.startNewGame(theme, m_playerName);
+    m_mode = Mode::Playing;
+    m_status = "Game started! Guess the word!";
+}
+
+void TerminalWindow::guessLetter(QChar letter)
+{
+    letter = letter.toUpper();
+    bool found = m_game.guessLetter(letter);
+
+    if (found) {
+        m_status = QString("Good guess! '%1' is in the word!").arg(letter);
+    } else {
+        m_status = QString("Sorry! '%1' is not in the word.").arg(letter);
+        if (m_game.getRemainingTries() == 2) {
+            m_status += " HINT APPLIED!";
+        }
+    }
+
+    if (m_game.isGameOver()) {
+        endGame();
+    }
+}
+
+void TerminalWindow::endGame()
+{
+    m_mode = Mode::GameOver;
+
+    if (m_game.isGameWon()) {
+        m_status = QString("YOU WON! The word was: %1. Score: %2 out of 7")
+                       .arg(m_game.getSecretWord().toUpper())
+                       .arg(m_game.getRemainingTries());
+        render();
+        promptForPlayerName();
+    } else {
+        m_status = QString("GAME OVER - The word was: %1")
+                       .arg(m_game.getSecretWord().toUpper());
+    }
+}
+
+void TerminalWindow::promptForPlayerName()
+{
+    // A named player's win is saved without asking again
+    QString playerName = m_playerName;
+    if (playerName.isEmpty()) {
+        playerName = readLine("Enter your name for the scoreboard (blank to skip): ");
+    }
+
+    if (!playerName.isEmpty()) {
+        int score = m_game.getRemainingTries();
+        m_game.saveScore(playerName, score);
+        m_status = QString("Your score has been saved! %1 - Score: %2/7").arg(playerName).arg(score);
+    }
+}
+
+QString TerminalWindow::readLine(const QString& prompt)
+{
+    // Line input needs the terminal back in cooked mode
+    restoreMode();
+    writeOut(QByteArray("\x1b[") + QByteArray::number(m_screen.size() + 1)
+             + ";1H\x1b[?25h  " + prompt.toUtf8());
+
+    QTextStream in(stdin);
+    const QString line = in.readLine().trimmed();
+
+    enableRawMode();
+    resetScreen(); // The prompt was written outside the tracked frame
+    return line;
+}
+
+int TerminalWindow::readKey()
+{
+#if defined(Q_OS_UNIX)
+    unsigned char c = 0;
+    for (;;) {
+        if (read(STDIN_FILENO, &c, 1) == 1) {
+            break;
+        }
+        if (errno != EINTR) {
+            return KEY_EOF;
+        }
+        if (g_resized) {
+            g_resized = 0;
+            return KEY_RESIZE;
+        }
+    }
+
+    if (c != KEY_ESCAPE) {
+        return c;
+    }
+
+    // A lone Esc is a key, but terminals also send "ESC [ ... final" (CSI) and
+    // "ESC O x" (SS3) for arrow and function keys, with the bytes back to back
+    int next = readByteWithin(30);
+    if (next == '[') {
+        int byte = readByteWithin(30);
+        while (byte >= 0 && (byte < 0x40 || byte > 0x7e)) {
+            byte = readByteWithin(30);
+        }
+        return KEY_SEQUENCE;
+    }
+    if (next == 'O') {
+        readByteWithin(30);
+        return KEY_SEQUENCE;
+    }
+    return next < 0 ? KEY_ESCAPE : KEY_SEQUENCE; // Alt+key sends ESC then the key
+#else
+    int c = std::getchar();
+    while (c == '\n' || c == '\r') {
+        c = std::getchar();
+    }
+    return c == EOF ? KEY_EOF : c;
+#endif
+}
+
+QStringList TerminalWindow::buildFrame() const
+{
+    QStringList lines;
+    lines << "  HANGMAN GAME" << "";
+
+    if (m_mode == Mode::Menu) {
+        lines << "  Select a theme:";
+        for (int theme = 0; theme < HangmanGame::THEME_COUNT; ++theme) {
+            lines << QString("    %1) %2").arg(theme + 1)
+                         .arg(HangmanGame::getThemeName(static_cast<HangmanGame::Theme>(theme)));
+        }
+        lines << "" << "  " + m_status << ""
+              << QString("  Press 1-%1 to start, N to set your name, Q to quit").arg(HangmanGame::THEME_COUNT);
+        return lines;
+    }
+
+    lines << "  Theme: " + HangmanGame::getThemeName(m_game.getCurrentTheme()) << "";
+
+    QStringList drawing = m_game.getHangmanDrawing().split('\n');
+    if (!drawing.isEmpty() && drawing.last().isEmpty()) {
+        drawing.removeLast();
+    }
+    lines << drawing << "";
+
+    // Drop the separators when the list would not fit on its row
+    QString guessed = m_game.getGuessedLetters();
+    if (guessed.size() + 20 > m_width) {
+        guessed.remove(QLatin1String(", "));
+    }
+
+    QStringList footer;
+    footer << ""
+           << QString("  Remaining Tries: %1").arg(m_game.getRemainingTries())
+           << "  Guessed Letters: " + (guessed.isEmpty() ? QString("None") : guessed)
+           << ""
+           << "  " + m_status
+           << "";
+
+    if (m_mode == Mode::Playing) {
+        footer << "  Type a letter to guess, Esc for the menu";
+    } else {
+        footer << "  Press any key to continue";
+    }
+
+    // A long phrase gets a window of rows, starting at the first row that still
+    // has hidden letters, so the frame fits the terminal. The last row is kept
+    // free so that writing the frame never scrolls the screen
+    const QStringList progress = wrapText(m_game.getCurrentProgress(), m_width - 4);
+    const int available = m_height - 1 - lines.size() - footer.size();
+    int first = 0;
+    int count = progress.size();
+    if (count > available) {
+        count = qMax(available - 1, 1); // One row goes to the position line
+        while (first < progress.size() - 1 && !progress[first].contains('_')) {
+            ++first;
+        }
+        first = qMin(first, progress.size() - count);
+    }
+
+    for (int row = first; row < first + count; ++row) {
+        lines << "  " + progress[row];
+    }
+    if (count < progress.size()) {
+        lines << QString("  (rows %1-%2 of %3)").arg(first + 1).arg(first + count).arg(progress.size());
+    }
+
+    lines << footer;
+    return lines;
+}
+
+void TerminalWindow::render()
+{
+    // Rows past the bottom or wider than the screen would be clamped by the
+    // terminal and break the diff, so the frame is clipped to fit first
+    QStringList frame = buildFrame().mid(0, qMax(m_height - 1, 1));
+    for (QString& line : frame) {
+        line.truncate(m_width);
+    }
+
+    // Rewrite each changed line from its first differing column only
+    QByteArray out;
+    int rows = qMax(frame.size(), m_screen.size());
+    for (int row = 0; row < rows; ++row) {
+        const QString next = row < frame.size() ? frame[row] : QString();
+        const QString prev = row < m_screen.size() ? m_screen[row] : QString();
+        if (next == prev) {
+            continue;
+        }
+
+        int col = 0;
+        while (col < next.size() && col < prev.size() && next[col] == prev[col]) {
+            ++col;
+        }
+
+        out += "\x1b[" + QByteArray::number(row + 1) + ';' + QByteArray::number(col + 1) + 'H';
+        out += next.mid(col).toUtf8();
+        out += "\x1b[K";
+    }
+
+    if (!out.isEmpty()) {
+        writeOut(out);
+    }
+    m_screen = frame;
+}
+
+void TerminalWindow::resetScreen()
+{
+    // Hide the cursor and clear, so the next render draws everything
+    writeOut("\x1b[?25l\x1b[2J\x1b[H");
+    m_screen.clear();
+}
+
+QStringList TerminalWindow::wrapText(const QString& text, int width)
+{
+    QStringList rows;
+    width = qMax(width, 8);
+
+    int start = 0;
+    while (text.size() - start > width) {
+        // Break at the last word gap that fits, or hard-break a long word.
+        // Letters sit one non-breaking space apart and words three spaces, so a gap is "   "
+        int end = text.lastIndexOf(QLatin1String("   "), start + width);
+        if (end <= start) {
+            end = start + width;
+        }
+        rows << text.mid(start, end - start);
+        start = end;
+        while (start < text.size() && text[start] == ' ') {
+            ++start;
+        }
+    }
+    rows << text.mid(start);
+    return rows;
+}
+
+void TerminalWindow::enableRawMode()
+{
+#if defined(Q_OS_UNIX)
+    if (g_rawModeActive || !isatty(STDIN_FILENO)) {
+        return;
+    }
+
+    tcgetattr(STDIN_FILENO, &g_savedMode);
+    termios raw = g_savedMode;
+    raw.c_lflag &= ~static_cast<tcflag_t>(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
+    g_rawModeActive = true;
+#endif
+}
+
+void TerminalWindow::restoreMode()
+{
+#if defined(Q_OS_UNIX)
+    restoreTerminal();
+#endif
+}
+
+int TerminalWindow::queryWidth() const
+{
+#if defined(Q_OS_UNIX)
+    winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0) {
+        return size.ws_col;
+    }
+#endif
+    return 80;
+}
+
+int TerminalWindow::queryHeight() const
+{
+#if defined(Q_OS_UNIX)
+    winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0) {
+        return size.ws_row;
+    }
+#endif
+    return 24;
+}
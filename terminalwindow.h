@@ -0,0 +1,68 @@
+#ifndef TERMINALWINDOW_H
+#define TERMINALWINDOW_H
+
+#include <QString>
+#include <QStringList>
+#include "hangmangame.h"
+#include "scoreboard.h"
+#include "gamelog.h"
+
+/**
+ * @brief The TerminalWindow class plays the game in a text terminal
+ * Needs only QtCore. Each frame is diffed against the previous one and only
+ * the changed part of each line is rewritten using ANSI escape codes
+ */
+class TerminalWindow
+{
+public:
+    TerminalWindow();
+    ~TerminalWindow();
+
+    int run();
+
+    // Captured when the first frame has been written
+    QString getFirstFrameStats() const { return m_firstFrameStats; }
+
+private:
+    enum class Mode {
+        Menu,
+        Playing,
+        GameOver
+    };
+
+    // Input handling
+    void handleKey(int key);
+    void startGame(HangmanGame::Theme theme);
+    void guessLetter(QChar letter);
+    void endGame();
+    void promptForPlayerName();
+    QString readLine(const QString& prompt);
+    int readKey();
+
+    // Drawing
+    QStringList buildFrame() const;
+    void render();
+    void resetScreen();
+    static QStringList wrapText(const QString& text, int width);
+
+    // Terminal state
+    void enableRawMode();
+    void restoreMode();
+    int queryWidth() const;
+    int queryHeight() const;
+
+    ScoreBoard m_scoreBoard; // Shared by every game played in this window
+    HangmanGame m_game;
+    GameLog m_eventLog;
+    Mode m_mode;
+    QString m_playerName; // Empty while playing anonymously
+    QString m_status;
+    bool m_running;
+
+    QStringList m_screen; // Last frame written to the terminal
+    int m_width;
+    int m_height;
+    QString m_firstFrameStats;
+};
+
+#endif // TERMINALWINDOW_H
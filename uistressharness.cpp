@@ -0,0 +1,192 @@
+#include "uistressharness.h"
+#include "mainwindow.h"
+#include <QApplication>
+#include <QDialog>
+#include <QKeyEvent>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <algorithm>
+
+UiStressHarness::UiStressHarness(MainWindow* window, int games, QObject* parent)
+    : QObject(parent)
+    , m_window(window)
+    , m_startButton(window->findChild<QPushButton*>("startButton"))
+    , m_letterInput(window->findChild<QLineEdit*>("letterInput"))
+    , m_guessedLettersLabel(window->findChild<QLabel*>("guessedLettersLabel"))
+    , m_gamesTotal(games)
+    , m_gamesPlayed(0)
+    , m_wins(0)
+    , m_gameOver(false)
+    , m_nextLetter(0)
+    , m_step(Step::Idle)
+    , m_inputSentNs(0)
+    , m_timeouts(0)
+{
+    m_latenciesNs.reserve(games * 12);
+    m_settledNs.reserve(games * 12);
+
+    // A guess that never repaints must not stall the run
+    m_watchdog.setSingleShot(true);
+    m_watchdog.setInterval(1000);
+    connect(&m_watchdog, &QTimer::timeout, this, &UiStressHarness::onPaintTimeout);
+
+    connect(m_window, &MainWindow::gameFinished, this, &UiStressHarness::onGameFinished);
+}
+
+void UiStressHarness::start()
+{
+    qApp->installEventFilter(this);
+    m_clock.start();
+    startNextGame();
+}
+
+bool UiStressHarness::eventFilter(QObject* watched, QEvent* event)
+{
+    if (m_step != Step::Idle && event->type() == QEvent::Paint && watched->isWidgetType()
+        && static_cast<QWidget*>(watched)->window() == m_window) {
+        qint64 latencyNs = m_clock.nsecsElapsed() - m_inputSentNs;
+        if (m_step == Step::AwaitGuessPaint) {
+            m_latenciesNs.append(latencyNs);
+        }
+
+        // Labels keep changing on clock ticks after the first paint, so the
+        // guess is only done once the last animation frame has painted
+        if (m_step != Step::AwaitStartPaint && m_window->isAnimating()) {
+            m_step = Step::AwaitSettledPaint;
+        } else {
+            if (m_step != Step::AwaitStartPaint) {
+                m_settledNs.append(latencyNs);
+            }
+            advance();
+        }
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void UiStressHarness::onGameFinished(bool won)
+{
+    m_gameOver = true;
+    m_gamesPlayed++;
+    if (won) {
+        m_wins++;
+    }
+}
+
+void UiStressHarness::onPaintTimeout()
+{
+    m_timeouts++;
+    advance();
+}
+
+void UiStressHarness::advance()
+{
+    m_watchdog.stop();
+    m_step = Step::Idle;
+
+    // Continue from the event loop rather than from inside a paint event
+    if (m_gameOver) {
+        QTimer::singleShot(0, this, &UiStressHarness::startNextGame);
+    } else {
+        QTimer::singleShot(0, this, &UiStressHarness::sendNextGuess);
+    }
+}
+
+void UiStressHarness::startNextGame()
+{
+    closeOpenDialogs();
+
+    if (m_gamesPlayed >= m_gamesTotal) {
+        qApp->removeEventFilter(this);
+        report();
+        emit finished();
+        return;
+    }
+
+    m_letters = "abcdefghijklmnopqrstuvwxyz";
+    std::shuffle(m_letters.begin(), m_letters.end(), *QRandomGenerator::global());
+    m_nextLetter = 0;
+    m_gameOver = false;
+
+    // Let the fresh board paint before timing the first guess
+    m_step = Step::AwaitStartPaint;
+    m_watchdog.start();
+    m_startButton->click();
+}
+
+void UiStressHarness::sendNextGuess()
+{
+    // Skip letters revealed by the auto-hint; the label reads "None" before any guess
+    QString guessed = m_guessedLettersLabel->text().section(':', 1).trimmed();
+    if (guessed == QLatin1String("None")) {
+        guessed.clear();
+    }
+    guessed = guessed.toLower();
+    while (m_nextLetter < m_letters.size() && guessed.contains(m_letters[m_nextLetter])) {
+        m_nextLetter++;
+    }
+
+    if (m_nextLetter >= m_letters.size()) {
+        m_gameOver = true; // Cannot happen with 7 tries, but never spin
+        m_gamesPlayed++;
+        advance();
+        return;
+    }
+
+    const QString text(m_letters[m_nextLetter++]);
+    m_step = Step::AwaitGuessPaint;
+    m_watchdog.start();
+    m_inputSentNs = m_clock.nsecsElapsed();
+
+    // Posted, not sent, so queueing delay is part of the measurement
+    QCoreApplication::postEvent(m_letterInput,
+                                new QKeyEvent(QEvent::KeyPress, Qt::Key_A + (text[0].unicode() - 'a'),
+                                              Qt::NoModifier, text));
+    QCoreApplication::postEvent(m_letterInput,
+                                new QKeyEvent(QEvent::KeyPress, Qt::Key_Return, Qt::NoModifier));
+}
+
+void UiStressHarness::closeOpenDialogs()
+{
+    // Answering one end-of-game dialog may open the next one in the chain
+    bool closedAny = true;
+    while (closedAny) {
+        closedAny = false;
+        for (QWidget* widget : QApplication::topLevelWidgets()) {
+            QDialog* dialog = qobject_cast<QDialog*>(widget);
+            if (dialog && dialog->isVisible()) {
+                dialog->reject();
+                closedAny = true;
+            }
+        }
+    }
+}
+
+void UiStressHarness::report()
+{
+    QTextStream out(stdout);
+    qint64 wallMs = m_clock.elapsed();
+
+    out << "UI stress: " << m_gamesPlayed << " games (" << m_wins << " won), "
+        << m_latenciesNs.size() << " guesses in " << wallMs << " ms, "
+        << m_timeouts << " paint timeouts\n";
+    out << "Animation frames: " << m_window->describeFrameStats() << "\n";
+
+    auto writePercentiles = [&out](const QString& name, QVector<qint64> sorted) {
+        if (sorted.isEmpty()) {
+            return;
+        }
+
+        std::sort(sorted.begin(), sorted.end());
+        auto percentileUs = [&sorted](double p) {
+            return sorted[static_cast<int>(p * (sorted.size() - 1))] / 1000;
+        };
+
+        out << name << " (us): p50 " << percentileUs(0.50)
+            << "  p90 " << percentileUs(0.90)
+            << "  p99 " << percentileUs(0.99)
+            << "  max " << sorted.last() / 1000 << "\n";
+    };
+
+    writePercentiles("Input-to-first-paint latency", m_latenciesNs);
+    writePercentiles("Input-to-settled latency, reveal animation included", m_settledNs);
+}
@@ -0,0 +1,76 @@
+#ifndef UISTRESSHARNESS_H
+#define UISTRESSHARNESS_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QVector>
+#include <QString>
+
+class MainWindow;
+class QLabel;
+class QLineEdit;
+class QPushButton;
+
+/**
+ * @brief The UiStressHarness class plays automated games through MainWindow
+ * Guesses are sent as synthetic key events and timed until the window
+ * first repaints and until the reveal animation has settled, then latency
+ * percentiles for both are printed
+ */
+class UiStressHarness : public QObject
+{
+    Q_OBJECT
+
+public:
+    UiStressHarness(MainWindow* window, int games, QObject* parent = nullptr);
+
+    void start();
+
+signals:
+    void finished();
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private slots:
+    void onGameFinished(bool won);
+    void onPaintTimeout();
+
+private:
+    enum class Step {
+        Idle,
+        AwaitStartPaint,
+        AwaitGuessPaint,
+        AwaitSettledPaint // The guess has painted, its animation is still running
+    };
+
+    void startNextGame();
+    void sendNextGuess();
+    void advance();
+    void closeOpenDialogs();
+    void report();
+
+    MainWindow* m_window;
+    QPushButton* m_startButton;
+    QLineEdit* m_letterInput;
+    QLabel* m_guessedLettersLabel;
+
+    int m_gamesTotal;
+    int m_gamesPlayed;
+    int m_wins;
+    bool m_gameOver;
+
+    QString m_letters;
+    int m_nextLetter;
+
+    Step m_step;
+    QElapsedTimer m_clock;
+    qint64 m_inputSentNs;
+    QVector<qint64> m_latenciesNs;
+    QVector<qint64> m_settledNs;
+    QTimer m_watchdog;
+    int m_timeouts;
+};
+
+#endif // UISTRESSHARNESS_H
@@ -0,0 +1,126 @@
+#include "worddictionary.h"
+#include <iterator>
+
+namespace {
+
+// Order matches HangmanGame::Theme
+constexpr std::string_view ANIMALS[] = {
+    "elephant", "giraffe", "penguin", "dolphin", "kangaroo",
+    "butterfly", "crocodile", "hippopotamus", "cheetah", "octopus"
+};
+
+constexpr std::string_view COUNTRIES[] = {
+    "australia", "brazil", "canada", "denmark", "egypt",
+    "france", "germany", "india", "japan", "mexico"
+};
+
+constexpr std::string_view FRUITS[] = {
+    "apple", "banana", "cherry", "mango", "orange",
+    "pineapple", "strawberry", "watermelon", "blueberry", "papaya"
+};
+
+constexpr std::string_view SPORTS[] = {
+    "football", "basketball", "tennis", "cricket", "volleyball",
+    "baseball", "hockey", "badminton", "swimming", "athletics"
+};
+
+constexpr std::string_view COLORS[] = {
+    "red", "blue", "green", "yellow", "purple",
+    "orange", "pink", "brown", "black", "white"
+};
+
+// Spaces and punctuation are revealed from the start of a game
+constexpr std::string_view PHRASES[] = {
+    "actions speak louder than words.",
+    "all that glitters is not gold.",
+    "better late than never!",
+    "fortune favors the bold.",
+    "the early bird catches the worm.",
+    "a journey of a thousand miles begins with a single step.",
+    "where there is a will, there is a way.",
+    "to be, or not to be: that is the question.",
+    "four score and seven years ago our fathers brought forth on this continent, "
+    "a new nation, conceived in liberty, and dedicated to the proposition that all "
+    "men are created equal. now we are engaged in a great civil war, testing whether "
+    "that nation, or any nation so conceived and so dedicated, can long endure. we are "
+    "met on a great battle-field of that war. we have come to dedicate a portion of "
+    "that field, as a final resting place for those who here gave their lives that "
+    "that nation might live. it is altogether fitting and proper that we should do "
+    "this. but, in a larger sense, we can not dedicate, we can not consecrate, we can "
+    "not hallow this ground. the brave men, living and dead, who struggled here, have "
+    "consecrated it, far above our poor power to add or detract. the world will little "
+    "note, nor long remember what we say here, but it can never forget what they did "
+    "here. it is for us the living, rather, to be dedicated here to the unfinished work "
+    "which they who fought here have thus far so nobly advanced. it is rather for us to "
+    "be here dedicated to the great task remaining before us, that from these honored "
+    "dead we take increased devotion to that cause for which they gave the last full "
+    "measure of devotion, that we here highly resolve that these dead shall not have "
+    "died in vain, that this nation, under god, shall have a new birth of freedom, and "
+    "that government of the people, by the people, for the people, shall not perish "
+    "from the earth."
+};
+
+constexpr WordDictionary::WordList BUILT_IN_LISTS[] = {
+    { ANIMALS, static_cast<int>(std::size(ANIMALS)) },
+    { COUNTRIES, static_cast<int>(std::size(COUNTRIES)) },
+    { FRUITS, static_cast<int>(std::size(FRUITS)) },
+    { SPORTS, static_cast<int>(std::size(SPORTS)) },
+    { COLORS, static_cast<int>(std::size(COLORS)) },
+    { PHRASES, static_cast<int>(std::size(PHRASES)) }
+};
+
+constexpr WordDictionary BUILT_IN(BUILT_IN_LISTS, static_cast<int>(std::size(BUILT_IN_LISTS)));
+
+// Entries are used as-is, so they must be lowercase printable ASCII
+constexpr bool isLowercaseWord(std::string_view word)
+{
+    for (char c : word) {
+        if (c < ' ' || c > '~' || (c >= 'A' && c <= 'Z')) {
+            return false;
+        }
+    }
+    return !word.empty();
+}
+
+constexpr bool allLowercase()
+{
+    for (const WordDictionary::WordList& list : BUILT_IN_LISTS) {
+        for (int i = 0; i < list.count; ++i) {
+            if (!isLowercaseWord(list.words[i])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(allLowercase(), "Built-in entries must be lowercase ASCII");
+
+} // namespace
+
+const WordDictionary& WordDictionary::builtIn()
+{
+    return BUILT_IN;
+}
+
+int WordDictionary::getWordCount(int list) const
+{
+    if (list < 0 || list >= m_listCount) {
+        return 0;
+    }
+    return m_lists[list].count;
+}
+
+std::string_view WordDictionary::getWordView(int list, int index) const
+{
+    if (index < 0 || index >= getWordCount(list)) {
+        return std::string_view();
+    }
+    return m_lists[list].words[index];
+}
+
+QString WordDictionary::getWord(int list, int index) const
+{
+    std::string_view word = getWordView(list, index);
+    return QString::fromLatin1(word.data(), static_cast<int>(word.size()));
+}
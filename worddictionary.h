@@ -0,0 +1,38 @@
+#ifndef WORDDICTIONARY_H
+#define WORDDICTIONARY_H
+
+#include <QString>
+#include <string_view>
+
+/**
+ * @brief The WordDictionary class is a read-only handle to word lists
+ * The built-in lists are constexpr tables laid out at compile time, so
+ * every handle points at the same single copy and copying one is free
+ */
+class WordDictionary
+{
+public:
+    struct WordList {
+        const std::string_view* words;
+        int count;
+    };
+
+    constexpr WordDictionary(const WordList* lists, int listCount)
+        : m_lists(lists)
+        , m_listCount(listCount)
+    {
+    }
+
+    static const WordDictionary& builtIn();
+
+    int getListCount() const { return m_listCount; }
+    int getWordCount(int list) const;
+    std::string_view getWordView(int list, int index) const;
+    QString getWord(int list, int index) const;
+
+private:
+    const WordList* m_lists;
+    int m_listCount;
+};
+
+#endif // WORDDICTIONARY_H